@@ -3,6 +3,8 @@
 import networkx as nx
 import numpy as np
 import subprocess
+import struct
+import array
 import tempfile
 import json
 import os
@@ -110,13 +112,20 @@ class GraphService:
                     str(max_iterations)
                 ], check=True)
                 
-                # ::::: Read results
+                # ::::: Read results: binary columnar (node id column, then a
+                # ::::: score column) loaded in one read instead of a text parse
                 pagerank = {}
-                with open(output_file.name, 'r') as f:
-                    for line in f:
-                        node_idx, score = line.strip().split()
-                        node = int_to_node[int(node_idx)]
-                        pagerank[node] = float(score)
+                with open(output_file.name, 'rb') as f:
+                    data = f.read()
+                magic, version, num_columns, _, num_rows = struct.unpack_from('<IIIIQ', data, 0)
+                if magic != 0x53525847:
+                    raise ValueError('Unexpected results file format')
+                nodes = array.array('i')
+                nodes.frombytes(data[24:24 + num_rows * 4])
+                scores = array.array('d')
+                scores.frombytes(data[24 + num_rows * 4:24 + num_rows * 12])
+                for node_idx, score in zip(nodes, scores):
+                    pagerank[int_to_node[node_idx]] = score
                 
                 # ::::: Clean up temporary files
                 os.unlink(input_file.name)
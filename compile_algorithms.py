@@ -19,12 +19,18 @@ logger = logging.getLogger(__name__)
 
 # Define C++ source files and their output binaries
 ALGORITHMS = [
-    {'source': 'cpp_algorithms/pagerank.cpp', 'output': 'cpp_algorithms/pagerank', 'deps': ['graph.h']},
-    {'source': 'cpp_algorithms/louvain.cpp', 'output': 'cpp_algorithms/louvain', 'deps': ['graph.h']},
+    {'source': 'cpp_algorithms/pagerank.cpp', 'output': 'cpp_algorithms/pagerank', 'deps': ['top_k.h', 'edge_list_reader.h', 'csr_graph.h', 'graph_io.h', 'results_writer.h', 'graph_shards.h', 'instrumentation.h']},
+    {'source': 'cpp_algorithms/louvain.cpp', 'output': 'cpp_algorithms/louvain', 'deps': ['graph.h', 'arena_allocator.h', 'instrumentation.h']},
     {'source': 'cpp_algorithms/dijkstra.cpp', 'output': 'cpp_algorithms/dijkstra', 'deps': ['graph.h']},
-    {'source': 'cpp_algorithms/hits.cpp', 'output': 'cpp_algorithms/hits', 'deps': ['graph.h']},
+    {'source': 'cpp_algorithms/hits.cpp', 'output': 'cpp_algorithms/hits', 'deps': ['graph.h', 'graph_shards.h', 'instrumentation.h']},
     {'source': 'cpp_algorithms/bfs_dfs.cpp', 'output': 'cpp_algorithms/bfs_dfs', 'deps': ['graph.h']},
-    {'source': 'cpp_algorithms/kcore.cpp', 'output': 'cpp_algorithms/kcore', 'deps': ['graph.h']}
+    {'source': 'cpp_algorithms/kcore.cpp', 'output': 'cpp_algorithms/kcore', 'deps': ['graph.h', 'instrumentation.h']},
+    {'source': 'cpp_algorithms/triangles.cpp', 'output': 'cpp_algorithms/triangles', 'deps': ['graph.h', 'top_k.h', 'edge_list_reader.h', 'csr_graph.h', 'graph_io.h', 'results_writer.h', 'instrumentation.h']},
+    {'source': 'cpp_algorithms/betweenness.cpp', 'output': 'cpp_algorithms/betweenness', 'deps': ['graph.h', 'top_k.h', 'edge_list_reader.h', 'csr_graph.h', 'graph_io.h', 'results_writer.h', 'instrumentation.h']},
+    {'source': 'cpp_algorithms/graph_convert.cpp', 'output': 'cpp_algorithms/graph_convert', 'deps': ['graph.h', 'csr_graph.h', 'compact_graph.h', 'arena_allocator.h', 'graph_io.h', 'edge_list_reader.h']},
+    {'source': 'cpp_algorithms/graph_server.cpp', 'output': 'cpp_algorithms/graph_server', 'deps': ['graph.h', 'csr_graph.h', 'compact_graph.h', 'arena_allocator.h', 'graph_io.h', 'edge_list_reader.h']},
+    {'source': 'cpp_algorithms/bench_algorithms.cpp', 'output': 'cpp_algorithms/bench_algorithms', 'deps': ['graph.h', 'csr_graph.h', 'compact_graph.h', 'arena_allocator.h', 'graph_io.h', 'edge_list_reader.h', 'top_k.h', 'graph_shards.h', 'results_writer.h', 'instrumentation.h']},
+    {'source': 'cpp_algorithms/analyze_all.cpp', 'output': 'cpp_algorithms/analyze_all', 'deps': ['graph.h', 'csr_graph.h', 'compact_graph.h', 'arena_allocator.h', 'graph_io.h', 'edge_list_reader.h', 'top_k.h', 'graph_shards.h', 'instrumentation.h']}
 ]
 
 def check_compiler() -> Optional[str]:
@@ -56,7 +62,7 @@ def get_compiler_flags(compiler: str) -> List[str]:
     if compiler == 'cl':  # MSVC
         return ['/std:c++17', '/O2', '/EHsc', '/W4']
     else:  # GCC/Clang
-        return ['-std=c++17', '-O3', '-Wall', '-Wextra', '-pedantic']
+        return ['-std=c++17', '-O3', '-Wall', '-Wextra', '-pedantic', '-pthread']
 
 def check_dependencies(algorithm: Dict[str, str], cpp_dir: str) -> bool:
     """Check if all dependencies for an algorithm exist."""
@@ -117,6 +123,42 @@ def compile_algorithm(algorithm: Dict[str, str], compiler: str, flags: List[str]
         logger.error(f"Error compiling {source_file}: {str(e)}")
         return False
 
+def compile_python_bindings(compiler: str, cpp_dir: str) -> None:
+    """Build the in-process pybind11 module when pybind11 is importable.
+
+    The bindings are optional: backends fall back to the subprocess path
+    when the module is absent, so a missing pybind11 is not a failure.
+    """
+    if compiler == 'cl':
+        logger.info("Skipping Python bindings: MSVC build path not configured")
+        return
+
+    try:
+        includes = subprocess.run(
+            [sys.executable, '-m', 'pybind11', '--includes'],
+            check=True, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True
+        ).stdout.split()
+        suffix = subprocess.run(
+            ['python3-config', '--extension-suffix'],
+            check=True, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True
+        ).stdout.strip()
+    except (subprocess.SubprocessError, FileNotFoundError):
+        logger.info("Skipping Python bindings: pybind11 not available")
+        return
+
+    source = os.path.join(cpp_dir, 'python_bindings.cpp')
+    output = os.path.join(cpp_dir, 'gitconnectx_native' + suffix)
+    cmd = [compiler, '-std=c++17', '-O3', '-shared', '-fPIC', '-pthread'] + includes + \
+          [source, '-o', output]
+    logger.info(f"Compiling Python bindings: {' '.join(cmd)}")
+
+    try:
+        subprocess.run(cmd, check=True, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+        logger.info(f"Successfully compiled: {output}")
+    except subprocess.CalledProcessError as e:
+        logger.error(f"Failed to compile Python bindings:\n{e.stderr}")
+
+
 def main():
     """Compile C++ algorithm implementations"""
     cpp_dir = 'cpp_algorithms'
@@ -158,6 +200,9 @@ def main():
         else:
             fail_count += 1
     
+    # Optional in-process Python module
+    compile_python_bindings(compiler, cpp_dir)
+
     # Print summary
     total = success_count + fail_count
     logger.info("\nCompilation Summary:")
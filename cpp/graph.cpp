@@ -1,22 +1,37 @@
-#include "graph.h"
-
-// ::::: Add an edge between src and dest
-void Graph::addEdge(const std::string& src, const std::string& dest) {
-    adjList[src].push_back(dest); // ::::: Add edge from src to dest
-}
-
-// ::::: Print the graph
-void Graph::printGraph() {
-    for (const auto& pair : adjList) {
-        std::cout << pair.first << " -> ";
-        for (const auto& neighbor : pair.second) {
-            std::cout << neighbor << " ";
-        }
-        std::cout << std::endl;
-    }
-}
-
-// ::::: Retrieve the adjacency list
-std::unordered_map<std::string, std::vector<std::string>> Graph::getAdjList() {
-    return adjList;
-}
\ No newline at end of file
+#include "graph.h"
+
+// ::::: Add an edge between src and dest, interning logins to dense ids
+void Graph::addEdge(const std::string& src, const std::string& dest) {
+    int srcId = interner.intern(src);
+    int destId = interner.intern(dest);
+    if (static_cast<size_t>(interner.size()) > adjList.size()) {
+        adjList.resize(interner.size());
+    }
+    adjList[srcId].push_back(destId); // ::::: Add edge from src to dest
+}
+
+// ::::: Print the graph
+void Graph::printGraph() {
+    for (size_t node = 0; node < adjList.size(); ++node) {
+        std::cout << interner.lookup(static_cast<int>(node)) << " -> ";
+        for (int neighbor : adjList[node]) {
+            std::cout << interner.lookup(neighbor) << " ";
+        }
+        std::cout << std::endl;
+    }
+}
+
+// ::::: Retrieve the adjacency list; by reference, so no per-call deep copy
+const std::vector<std::vector<int>>& Graph::getAdjacency() const {
+    return adjList;
+}
+
+// ::::: Retrieve the login dictionary for output-side lookups
+const StringInterner& Graph::getInterner() const {
+    return interner;
+}
+
+// ::::: Persist the dictionary so other tools can decode integer results
+bool Graph::saveDictionary(const std::string& filename) const {
+    return interner.save(filename);
+}
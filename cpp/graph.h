@@ -1,19 +1,22 @@
-#ifndef GRAPH_H
-#define GRAPH_H
-
-#include <unordered_map>
-#include <vector>
-#include <string>
-#include <iostream>
-
-class Graph {
-private:
-    std::unordered_map<std::string, std::vector<std::string>> adjList; // ::::: Adjacency List
-
-public:
-    void addEdge(const std::string& src, const std::string& dest); // ::::: Adds an edge to the graph
-    void printGraph(); // ::::: Prints the graph
-    std::unordered_map<std::string, std::vector<std::string>> getAdjList(); // ::::: Returns the adjacency list
-};
-
-#endif
\ No newline at end of file
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include "string_interner.h"
+#include <vector>
+#include <string>
+#include <iostream>
+
+class Graph {
+private:
+    StringInterner interner;               // ::::: login <-> dense id dictionary
+    std::vector<std::vector<int>> adjList; // ::::: Adjacency list over dense ids
+
+public:
+    void addEdge(const std::string& src, const std::string& dest); // ::::: Adds an edge to the graph
+    void printGraph(); // ::::: Prints the graph
+    const std::vector<std::vector<int>>& getAdjacency() const; // ::::: Returns the integer adjacency by reference
+    const StringInterner& getInterner() const; // ::::: Returns the login dictionary
+    bool saveDictionary(const std::string& filename) const; // ::::: Persist the id <-> login dictionary
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "string_interner.h"
+#include <fstream>
+#include <stdexcept>
+
+// ::::: Return the dense id for a login, assigning the next one if unseen
+int StringInterner::intern(const std::string& login) {
+    auto inserted = idByLogin.emplace(login, static_cast<int>(loginById.size()));
+    if (inserted.second) {
+        loginById.push_back(login);
+    }
+    return inserted.first->second;
+}
+
+// ::::: Look up a login without interning it
+int StringInterner::find(const std::string& login) const {
+    auto it = idByLogin.find(login);
+    return it != idByLogin.end() ? it->second : -1;
+}
+
+// ::::: Map a dense id back to its login
+const std::string& StringInterner::lookup(int id) const {
+    if (id < 0 || static_cast<size_t>(id) >= loginById.size()) {
+        throw std::out_of_range("Interned id out of range");
+    }
+    return loginById[id];
+}
+
+int StringInterner::size() const {
+    return static_cast<int>(loginById.size());
+}
+
+// ::::: Persist the dictionary: line i is the login for id i
+bool StringInterner::save(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+    for (const auto& login : loginById) {
+        file << login << "\n";
+    }
+    return true;
+}
+
+// ::::: Replace contents from a dictionary file written by save()
+bool StringInterner::load(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+    idByLogin.clear();
+    loginById.clear();
+    std::string login;
+    while (std::getline(file, login)) {
+        idByLogin.emplace(login, static_cast<int>(loginById.size()));
+        loginById.push_back(login);
+    }
+    return true;
+}
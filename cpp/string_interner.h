@@ -0,0 +1,26 @@
+#ifndef STRING_INTERNER_H
+#define STRING_INTERNER_H
+
+#include <unordered_map>
+#include <vector>
+#include <string>
+
+// ::::: Maps login names to dense integer ids so computation runs on integer
+// ::::: graphs; strings are touched only at ingest and output. The dictionary
+// ::::: persists as plain text (line i holds the login for id i), the same
+// ::::: id space the cpp_algorithms binaries consume as integer edge lists.
+class StringInterner {
+private:
+    std::unordered_map<std::string, int> idByLogin; // ::::: login -> dense id
+    std::vector<std::string> loginById;             // ::::: dense id -> login
+
+public:
+    int intern(const std::string& login);           // ::::: Returns the id, assigning the next dense one if new
+    int find(const std::string& login) const;       // ::::: Returns the id, or -1 if the login is unknown
+    const std::string& lookup(int id) const;        // ::::: Returns the login for a dense id
+    int size() const;                               // ::::: Number of interned logins
+    bool save(const std::string& filename) const;   // ::::: Write the id -> login dictionary
+    bool load(const std::string& filename);         // ::::: Replace contents from a dictionary file
+};
+
+#endif
@@ -0,0 +1,253 @@
+#include "graph.h"
+#include "csr_graph.h"
+#include "graph_io.h"
+#include "instrumentation.h"
+#include "graph_build.cpp"
+#include "bfs_dfs.cpp"
+#include "louvain.cpp"
+#include "kcore.cpp"
+#include "hits.cpp"
+
+#define PAGERANK_NO_MAIN
+#include "pagerank.cpp"
+
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <chrono>
+
+// ::::: Single-pass multi-metric pipeline: the nightly job used to run the
+// ::::: pagerank, hits, kcore, bfs_dfs and louvain binaries back to back,
+// ::::: each re-loading the same edge list. This binary loads the graph once
+// ::::: and schedules the requested algorithms concurrently over the shared
+// ::::: read-only structure, writing one combined results file with a
+// ::::: section per metric.
+
+struct AnalysisTask {
+    std::string name;
+    std::function<std::string()> run;
+    std::string output;
+    std::string error;
+    double seconds = 0.0;
+};
+
+// ::::: Run PageRank through the same engine the standalone binary uses.
+// ::::: The engine indexes nodes densely, so size it by the largest vertex id.
+static std::string runPageRank(const Graph& graph) {
+    std::vector<int> vertices = graph.getVertices();
+    int n = 0;
+    size_t arcs = 0;
+    for (int v : vertices) {
+        n = std::max(n, v + 1);
+        arcs += graph.getNeighbors(v).size();
+    }
+
+    PageRank pagerank(n, static_cast<int>(arcs));
+    for (int v : vertices) {
+        for (const auto& [to, weight] : graph.getNeighbors(v)) {
+            pagerank.add_edge(v, to, weight);
+        }
+    }
+    pagerank.compute();
+
+    std::ostringstream oss;
+    auto scores = pagerank.get_scores();
+    for (int v = 0; v < n; ++v) {
+        oss << v << " " << scores[v] << "\n";
+    }
+    return oss.str();
+}
+
+static std::string runHITS(const Graph& graph) {
+    auto result = HITS::calculate(graph);
+    std::ostringstream oss;
+    for (size_t v = 0; v < result.hubScores.size(); ++v) {
+        oss << v << " " << result.hubScores[v] << " " << result.authorityScores[v] << "\n";
+    }
+    return oss.str();
+}
+
+static std::string runKCore(const Graph& graph) {
+    auto result = KCore::decompose(graph);
+    std::ostringstream oss;
+    for (size_t v = 0; v < result.coreNumbers.size(); ++v) {
+        oss << v << " " << result.coreNumbers[v] << "\n";
+    }
+    return oss.str();
+}
+
+static std::string runLouvain(const Graph& graph) {
+    auto result = Louvain::detectCommunities(graph);
+    std::ostringstream oss;
+    oss << "# communities " << result.numCommunities
+        << " modularity " << result.modularity << "\n";
+    for (size_t v = 0; v < result.communities.size(); ++v) {
+        oss << v << " " << result.communities[v] << "\n";
+    }
+    return oss.str();
+}
+
+static std::string runComponents(const Graph& graph) {
+    auto components = GraphTraversal::findConnectedComponentsUnionFind(graph);
+    std::ostringstream oss;
+    oss << "# components " << components.size() << "\n";
+    for (size_t c = 0; c < components.size(); ++c) {
+        for (int v : components[c]) {
+            oss << v << " " << c << "\n";
+        }
+    }
+    return oss.str();
+}
+
+static std::string runBFS(const Graph& graph, int source) {
+    auto [traversal, distances] = GraphTraversal::bfsLevelSynchronous(graph, source);
+    std::ostringstream oss;
+    oss << "# source " << source << " reached " << traversal.size() << "\n";
+    for (size_t v = 0; v < distances.size(); ++v) {
+        oss << v << " " << distances[v] << "\n";
+    }
+    return oss.str();
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        // ::::: Separate flags from positional arguments
+        bool directed = true;
+        int numThreads = 0;
+        int bfsSource = 0;
+        bool emitStats = false;
+        std::string algorithms = "pagerank,hits,kcore,louvain,components,bfs";
+        std::vector<std::string> args;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--undirected") {
+                directed = false;
+            } else if (arg == "--stats") {
+                emitStats = true;
+            } else if (arg == "--algorithms") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--algorithms requires a value");
+                }
+                algorithms = argv[++i];
+            } else if (arg == "--threads") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--threads requires a value");
+                }
+                numThreads = std::stoi(argv[++i]);
+            } else if (arg == "--bfs-source") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--bfs-source requires a value");
+                }
+                bfsSource = std::stoi(argv[++i]);
+            } else {
+                args.push_back(arg);
+            }
+        }
+
+        if (args.size() < 2) {
+            std::cerr << "Usage: " << argv[0]
+                      << " input_edge_list output_file [--undirected]"
+                      << " [--algorithms pagerank,hits,kcore,louvain,components,bfs]"
+                      << " [--threads N] [--bfs-source N] [--stats]" << std::endl;
+            return 1;
+        }
+
+        Instrumentation::enable(emitStats);
+
+        // ::::: One graph load shared by every algorithm
+        std::cout << "Loading graph from " << args[0] << std::endl;
+        Graph graph = [&]() {
+            Instrumentation::ScopedTimer timer("stage.load");
+            return GraphBuilder::buildFromEdgeList(args[0], directed);
+        }();
+        std::cout << "Graph: " << graph.getNumVertices() << " vertices, "
+                  << graph.getNumEdges() << " edges ("
+                  << (directed ? "directed" : "undirected") << ")" << std::endl;
+
+        // ::::: Assemble the requested task list
+        std::vector<AnalysisTask> tasks;
+        std::istringstream nameStream(algorithms);
+        std::string name;
+        while (std::getline(nameStream, name, ',')) {
+            if (name == "pagerank") {
+                tasks.push_back({name, [&]() { return runPageRank(graph); }, "", ""});
+            } else if (name == "hits") {
+                if (!directed) {
+                    std::cerr << "Skipping hits: requires a directed graph" << std::endl;
+                    continue;
+                }
+                tasks.push_back({name, [&]() { return runHITS(graph); }, "", ""});
+            } else if (name == "kcore") {
+                tasks.push_back({name, [&]() { return runKCore(graph); }, "", ""});
+            } else if (name == "louvain") {
+                tasks.push_back({name, [&]() { return runLouvain(graph); }, "", ""});
+            } else if (name == "components") {
+                tasks.push_back({name, [&]() { return runComponents(graph); }, "", ""});
+            } else if (name == "bfs") {
+                tasks.push_back({name, [&]() { return runBFS(graph, bfsSource); }, "", ""});
+            } else if (!name.empty()) {
+                throw std::invalid_argument("Unknown algorithm: " + name);
+            }
+        }
+
+        // ::::: Schedule independent algorithms concurrently; each worker
+        // ::::: pulls the next task off an atomic counter
+        if (numThreads <= 0) {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        int workers = std::max(1, std::min<int>(numThreads, static_cast<int>(tasks.size())));
+        std::atomic<size_t> nextTask{0};
+        std::vector<std::thread> pool;
+        for (int t = 0; t < workers; ++t) {
+            pool.emplace_back([&]() {
+                for (size_t i = nextTask.fetch_add(1); i < tasks.size();
+                     i = nextTask.fetch_add(1)) {
+                    auto start = std::chrono::steady_clock::now();
+                    try {
+                        tasks[i].output = tasks[i].run();
+                    } catch (const std::exception& e) {
+                        tasks[i].error = e.what();
+                    }
+                    tasks[i].seconds = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start).count();
+                    Instrumentation::addTime("task." + tasks[i].name, tasks[i].seconds);
+                }
+            });
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+
+        // ::::: One combined results file, a section per metric
+        Instrumentation::ScopedTimer writeTimer("stage.write");
+        std::ofstream out(args[1]);
+        if (!out.is_open()) {
+            throw std::runtime_error("Could not open output file: " + args[1]);
+        }
+        bool failed = false;
+        for (const auto& task : tasks) {
+            if (!task.error.empty()) {
+                std::cerr << "Error in " << task.name << ": " << task.error << std::endl;
+                failed = true;
+                continue;
+            }
+            out << "=== " << task.name << " ===\n" << task.output;
+            std::cout << task.name << " finished in " << task.seconds << "s" << std::endl;
+        }
+        std::cout << "Results written to " << args[1] << std::endl;
+
+        if (emitStats) {
+            std::cout << Instrumentation::toJson() << std::endl;
+        }
+
+        return failed ? 1 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,310 @@
+#include "graph.h"
+#include "top_k.h"
+#include "edge_list_reader.h"
+#include "graph_io.h"
+#include "results_writer.h"
+#include "instrumentation.h"
+#include <vector>
+#include <queue>
+#include <stack>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <sstream>
+#include <iomanip>
+
+// ::::: Brandes betweenness centrality. One BFS plus one dependency
+// ::::: back-propagation per source; sources are partitioned across worker
+// ::::: threads pulling from an atomic counter, each accumulating into a
+// ::::: thread-local score vector that is reduced after the join. Passing
+// ::::: numSamples > 0 runs only that many uniformly sampled sources and
+// ::::: scales the scores by n/numSamples — the standard approximation for
+// ::::: graphs where all n sources are too slow.
+class Betweenness {
+public:
+    struct Result {
+        std::vector<double> centralityScores;
+        int sampledSources;  // ::::: 0 means exact (every source)
+        double maxCentrality;
+
+        Result(const std::vector<double>& scores, int sampled)
+            : centralityScores(scores), sampledSources(sampled) {
+            maxCentrality = scores.empty()
+                ? 0.0 : *std::max_element(scores.begin(), scores.end());
+        }
+
+        std::string getSummary(int topK = 5) const {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(6);
+
+            oss << "Betweenness Centrality Results:\n";
+            if (sampledSources > 0) {
+                oss << "Approximated from " << sampledSources << " sampled sources\n";
+            } else {
+                oss << "Exact (all sources)\n";
+            }
+            oss << "Maximum centrality: " << maxCentrality << "\n\n";
+
+            oss << "Top " << topK << " Nodes:\n";
+            for (const auto& [node, score] : TopK::select(centralityScores, topK)) {
+                oss << "Node " << node << ": " << score << "\n";
+            }
+
+            return oss.str();
+        }
+    };
+
+    template <typename GraphT>
+    static Result calculate(const GraphT& graph, int numSamples = 0,
+                            int numThreads = 0, unsigned seed = 42) {
+        int n = graph.getNumVertices();
+        if (n == 0) throw std::invalid_argument("Graph is empty");
+        if (numSamples < 0) throw std::invalid_argument("Sample count cannot be negative");
+
+        // ::::: Pick the sources: everything, or a uniform sample
+        std::vector<int> sources(n);
+        std::iota(sources.begin(), sources.end(), 0);
+        if (numSamples > 0 && numSamples < n) {
+            std::mt19937 rng(seed);
+            std::shuffle(sources.begin(), sources.end(), rng);
+            sources.resize(numSamples);
+        } else {
+            numSamples = 0;
+        }
+
+        if (numThreads <= 0) {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        int workers = std::max(1, std::min<int>(numThreads, static_cast<int>(sources.size())));
+
+        std::vector<std::vector<double>> partials(workers, std::vector<double>(n, 0.0));
+        std::atomic<size_t> nextSource{0};
+        std::mutex errorMutex;
+        std::exception_ptr firstError = nullptr;
+
+        std::vector<std::thread> pool;
+        for (int t = 0; t < workers; ++t) {
+            pool.emplace_back([&, t]() {
+                try {
+                    // ::::: Per-thread Brandes scratch, reused across sources
+                    std::vector<double>& centrality = partials[t];
+                    std::vector<int> distances(n), order;
+                    std::vector<double> sigma(n), delta(n);
+                    std::vector<std::vector<int>> predecessors(n);
+                    order.reserve(n);
+
+                    for (size_t i = nextSource.fetch_add(1); i < sources.size();
+                         i = nextSource.fetch_add(1)) {
+                        accumulateFromSource(graph, sources[i], centrality,
+                                             distances, sigma, delta, predecessors, order);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!firstError) firstError = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+
+        // ::::: Reduce the per-thread partials
+        std::vector<double> scores(n, 0.0);
+        for (const auto& partial : partials) {
+            for (int v = 0; v < n; ++v) {
+                scores[v] += partial[v];
+            }
+        }
+
+        // ::::: Undirected paths were counted from both endpoints; sampling
+        // ::::: scales the partial sums up to the full source set
+        double scale = graph.isDirectedGraph() ? 1.0 : 0.5;
+        if (numSamples > 0) {
+            scale *= static_cast<double>(n) / numSamples;
+        }
+        for (double& score : scores) {
+            score *= scale;
+        }
+
+        return Result(scores, numSamples);
+    }
+
+private:
+    // ::::: One Brandes pass: BFS records shortest-path counts (sigma) and
+    // ::::: predecessors, then dependencies (delta) flow back in reverse
+    // ::::: BFS order. Hop-count shortest paths, matching the BFS traversals
+    // ::::: the rest of the pipeline uses.
+    template <typename GraphT>
+    static void accumulateFromSource(const GraphT& graph, int source,
+                                     std::vector<double>& centrality,
+                                     std::vector<int>& distances,
+                                     std::vector<double>& sigma,
+                                     std::vector<double>& delta,
+                                     std::vector<std::vector<int>>& predecessors,
+                                     std::vector<int>& order) {
+        std::fill(distances.begin(), distances.end(), -1);
+        std::fill(sigma.begin(), sigma.end(), 0.0);
+        std::fill(delta.begin(), delta.end(), 0.0);
+        for (auto& preds : predecessors) {
+            preds.clear();
+        }
+        order.clear();
+
+        distances[source] = 0;
+        sigma[source] = 1.0;
+        std::queue<int> frontier;
+        frontier.push(source);
+        while (!frontier.empty()) {
+            int current = frontier.front();
+            frontier.pop();
+            order.push_back(current);
+            for (const auto& neighbor : graph.getNeighbors(current)) {
+                int next = neighbor.first;
+                if (distances[next] == -1) {
+                    distances[next] = distances[current] + 1;
+                    frontier.push(next);
+                }
+                if (distances[next] == distances[current] + 1) {
+                    sigma[next] += sigma[current];
+                    predecessors[next].push_back(current);
+                }
+            }
+        }
+
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            int w = *it;
+            for (int v : predecessors[w]) {
+                delta[v] += sigma[v] / sigma[w] * (1.0 + delta[w]);
+            }
+            if (w != source) {
+                centrality[w] += delta[w];
+            }
+        }
+    }
+};
+
+#ifndef BETWEENNESS_NO_MAIN
+// ::::: Standalone binary: reads an edge list, writes a binary results file
+// ::::: (or "node score" text lines with --text)
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    try {
+        int numSamples = 0;
+        int numThreads = 0;
+        bool directed = true;
+        bool textOutput = false;
+        bool emitStats = false;
+        std::vector<std::string> args;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--undirected") {
+                directed = false;
+            } else if (arg == "--text") {
+                textOutput = true;
+            } else if (arg == "--stats") {
+                emitStats = true;
+            } else if (arg == "--samples") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--samples requires a value");
+                }
+                numSamples = std::stoi(argv[++i]);
+            } else if (arg == "--threads") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--threads requires a value");
+                }
+                numThreads = std::stoi(argv[++i]);
+            } else {
+                args.push_back(arg);
+            }
+        }
+
+        if (args.size() < 2) {
+            std::cerr << "Usage: " << argv[0]
+                      << " input_edge_list output_file [--undirected]"
+                      << " [--samples N] [--threads N] [--text] [--stats]" << std::endl;
+            return 1;
+        }
+
+        Instrumentation::enable(emitStats);
+
+        // ::::: Binary graph files (from graph_convert) are detected by magic
+        // ::::: and memory-mapped, so the kernel runs straight off the mapped
+        // ::::: arrays; anything else goes through the edge-list reader
+        bool binaryGraph = false;
+        {
+            std::ifstream probe(args[0], std::ios::binary);
+            if (!probe.is_open()) {
+                throw std::runtime_error("Could not open input file: " + args[0]);
+            }
+            uint32_t magic = 0;
+            probe.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            binaryGraph = probe && magic == GraphFileHeader::MAGIC;
+        }
+
+        std::unique_ptr<Betweenness::Result> result;
+        if (binaryGraph) {
+            // ::::: Directedness comes from the file header in this path
+            std::unique_ptr<MappedCSRGraph> mapped;
+            {
+                Instrumentation::ScopedTimer timer("stage.load");
+                mapped = std::make_unique<MappedCSRGraph>(args[0]);
+            }
+            std::cout << "Graph: " << mapped->getNumVertices() << " vertices, "
+                      << mapped->getNumEdges() << " edges (mapped)" << std::endl;
+
+            Instrumentation::ScopedTimer timer("stage.compute");
+            result = std::make_unique<Betweenness::Result>(
+                Betweenness::calculate(*mapped, numSamples, numThreads));
+        } else {
+            Graph graph(directed);
+            {
+                Instrumentation::ScopedTimer timer("stage.load");
+                for (const auto& edge : EdgeListReader::read(args[0])) {
+                    if (edge.from < 0 || edge.to < 0) {
+                        throw std::invalid_argument("Vertex IDs cannot be negative");
+                    }
+                    graph.addEdgeUnchecked(edge.from, edge.to, edge.weight);
+                }
+                graph.finalizeEdges();
+            }
+            std::cout << "Graph: " << graph.getNumVertices() << " vertices, "
+                      << graph.getNumEdges() << " edges" << std::endl;
+
+            Instrumentation::ScopedTimer timer("stage.compute");
+            result = std::make_unique<Betweenness::Result>(
+                Betweenness::calculate(graph, numSamples, numThreads));
+        }
+        std::cout << result->getSummary() << std::endl;
+
+        {
+            Instrumentation::ScopedTimer timer("stage.write");
+            if (textOutput) {
+                ResultsWriter::writeText(args[1], result->centralityScores);
+            } else {
+                ResultsWriter::writeBinary(args[1], result->centralityScores);
+            }
+        }
+        std::cout << "Results written to " << args[1] << std::endl;
+
+        if (emitStats) {
+            std::cout << Instrumentation::toJson() << std::endl;
+        }
+
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
+#endif
@@ -4,28 +4,15 @@
 #include <vector>
 #include <unordered_set>
 #include <stdexcept>
+#include <atomic>
+#include <thread>
+#include <cstdint>
 
 class GraphTraversal {
-private:
-    static void dfsRecursiveForComponents(
-        const Graph& graph,
-        int vertex,
-        std::unordered_set<int>& visited,
-        std::vector<int>& component) {
-        
-        visited.insert(vertex);
-        component.push_back(vertex);
-        
-        for (const auto& neighbor : graph.getNeighbors(vertex)) {
-            if (visited.find(neighbor.first) == visited.end()) {
-                dfsRecursiveForComponents(graph, neighbor.first, visited, component);
-            }
-        }
-    }
-
 public:
     // ::::: BFS implementation with distance tracking
-    static std::pair<std::vector<int>, std::vector<int>> bfs(const Graph& graph, int startVertex) {
+    template <typename GraphT>
+    static std::pair<std::vector<int>, std::vector<int>> bfs(const GraphT& graph, int startVertex) {
         if (!graph.hasVertex(startVertex)) {
             throw std::invalid_argument("Start vertex does not exist in the graph");
         }
@@ -57,9 +44,131 @@ public:
         return {traversal, distances};
     }
     
+    // ::::: Level-synchronous BFS: flat frontier vectors, a bitmap visited
+    // ::::: set (one atomic fetch_or per discovery instead of a hash probe
+    // ::::: and insert), and node-range partitioning of each level across
+    // ::::: threads. On undirected graphs dense middle levels switch to
+    // ::::: bottom-up sweeps, where unvisited vertices look for any visited
+    // ::::: parent instead of the frontier scattering to all its neighbors.
+    template <typename GraphT>
+    static std::pair<std::vector<int>, std::vector<int>> bfsLevelSynchronous(
+        const GraphT& graph, int startVertex, int numThreads = 0) {
+        if (!graph.hasVertex(startVertex)) {
+            throw std::invalid_argument("Start vertex does not exist in the graph");
+        }
+        if (numThreads < 0) {
+            throw std::invalid_argument("Thread count cannot be negative");
+        }
+        if (numThreads == 0) {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        int n = graph.getNumVertices();
+        std::vector<int> distances(n, -1);
+        std::vector<std::atomic<uint64_t>> visited((n + 63) / 64);
+        for (auto& word : visited) {
+            word.store(0, std::memory_order_relaxed);
+        }
+
+        // ::::: Claim a vertex; returns true for the first caller only
+        auto claim = [&](int v) {
+            uint64_t bit = uint64_t(1) << (v & 63);
+            return (visited[v >> 6].fetch_or(bit) & bit) == 0;
+        };
+        auto isVisited = [&](int v) {
+            return (visited[v >> 6].load(std::memory_order_relaxed) &
+                    (uint64_t(1) << (v & 63))) != 0;
+        };
+
+        std::vector<int> traversal;
+        std::vector<int> frontier{startVertex};
+        claim(startVertex);
+        distances[startVertex] = 0;
+        int level = 0;
+
+        std::vector<uint64_t> frontierBits((n + 63) / 64);
+        while (!frontier.empty()) {
+            traversal.insert(traversal.end(), frontier.begin(), frontier.end());
+
+            // ::::: Bottom-up pays off once the frontier covers a sizable
+            // ::::: fraction of the graph; it needs symmetric adjacency
+            bool bottomUp = !graph.isDirectedGraph() &&
+                            frontier.size() > static_cast<size_t>(n) / 20;
+
+            // ::::: Snapshot the frontier into a read-only bitmap before the
+            // ::::: workers start: bottom-up threads write distances for their
+            // ::::: own ranges while scanning neighbors anywhere, so testing
+            // ::::: distances[] for frontier membership would race
+            if (bottomUp) {
+                std::fill(frontierBits.begin(), frontierBits.end(), 0);
+                for (int v : frontier) {
+                    frontierBits[v >> 6] |= uint64_t(1) << (v & 63);
+                }
+            }
+            auto inFrontier = [&](int v) {
+                return (frontierBits[v >> 6] & (uint64_t(1) << (v & 63))) != 0;
+            };
+
+            int threads = std::max(1, std::min<int>(numThreads,
+                static_cast<int>(bottomUp ? n : frontier.size())));
+            std::vector<std::vector<int>> nextPerThread(threads);
+            std::vector<std::thread> workers;
+
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t]() {
+                    std::vector<int>& next = nextPerThread[t];
+                    if (bottomUp) {
+                        // ::::: Each thread owns a vertex range; unvisited
+                        // ::::: vertices adopt any parent at the current level
+                        int chunk = (n + threads - 1) / threads;
+                        int begin = t * chunk;
+                        int end = std::min(n, begin + chunk);
+                        for (int v = begin; v < end; ++v) {
+                            if (isVisited(v)) continue;
+                            for (const auto& neighbor : graph.getNeighbors(v)) {
+                                if (inFrontier(neighbor.first)) {
+                                    claim(v);
+                                    distances[v] = level + 1;
+                                    next.push_back(v);
+                                    break;
+                                }
+                            }
+                        }
+                    } else {
+                        // ::::: Top-down: threads split the frontier and race
+                        // ::::: on the visited bitmap to claim discoveries
+                        size_t chunk = (frontier.size() + threads - 1) / threads;
+                        size_t begin = t * chunk;
+                        size_t end = std::min(frontier.size(), begin + chunk);
+                        for (size_t i = begin; i < end; ++i) {
+                            for (const auto& neighbor : graph.getNeighbors(frontier[i])) {
+                                if (claim(neighbor.first)) {
+                                    distances[neighbor.first] = level + 1;
+                                    next.push_back(neighbor.first);
+                                }
+                            }
+                        }
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            frontier.clear();
+            for (const auto& next : nextPerThread) {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+            }
+            level++;
+        }
+
+        return {traversal, distances};
+    }
+
     // ::::: DFS implementation (iterative)
+    template <typename GraphT>
     static std::tuple<std::vector<int>, std::vector<int>, std::vector<int>> 
-    dfs(const Graph& graph, int startVertex) {
+    dfs(const GraphT& graph, int startVertex) {
         if (!graph.hasVertex(startVertex)) {
             throw std::invalid_argument("Start vertex does not exist in the graph");
         }
@@ -101,7 +210,8 @@ public:
     }
     
     // ::::: DFS implementation (recursive)
-    static void dfsRecursive(const Graph& graph, int vertex, 
+    template <typename GraphT>
+    static void dfsRecursive(const GraphT& graph, int vertex, 
                            std::unordered_set<int>& visited,
                            std::vector<int>& traversal,
                            std::vector<int>& discoveryTime,
@@ -121,8 +231,9 @@ public:
         finishTime[vertex] = time++;
     }
     
+    template <typename GraphT>
     static std::tuple<std::vector<int>, std::vector<int>, std::vector<int>>
-    dfsRecursive(const Graph& graph, int startVertex) {
+    dfsRecursive(const GraphT& graph, int startVertex) {
         if (!graph.hasVertex(startVertex)) {
             throw std::invalid_argument("Start vertex does not exist in the graph");
         }
@@ -139,19 +250,96 @@ public:
         return {traversal, discoveryTime, finishTime};
     }
     
-    // ::::: Find connected components using DFS
-    static std::vector<std::vector<int>> findConnectedComponents(const Graph& graph) {
+    // ::::: Find connected components with an iterative DFS. An explicit
+    // ::::: stack replaces the old recursive helper, which overflowed the
+    // ::::: call stack on follower chains a few hundred thousand nodes long.
+    template <typename GraphT>
+    static std::vector<std::vector<int>> findConnectedComponents(const GraphT& graph) {
         std::vector<std::vector<int>> components;
         std::unordered_set<int> visited;
-        
+        std::stack<int> pending;
+
         for (int vertex : graph.getVertices()) {
-            if (visited.find(vertex) == visited.end()) {
-                std::vector<int> component;
-                dfsRecursiveForComponents(graph, vertex, visited, component);
-                components.push_back(component);
+            if (visited.find(vertex) != visited.end()) {
+                continue;
             }
+            std::vector<int> component;
+            pending.push(vertex);
+            visited.insert(vertex);
+
+            while (!pending.empty()) {
+                int current = pending.top();
+                pending.pop();
+                component.push_back(current);
+
+                for (const auto& neighbor : graph.getNeighbors(current)) {
+                    if (visited.insert(neighbor.first).second) {
+                        pending.push(neighbor.first);
+                    }
+                }
+            }
+            components.push_back(component);
         }
-        
+
+        return components;
+    }
+
+    // ::::: Union-find component labeling: one linear sweep over the edges
+    // ::::: with path compression and union by rank, so labeling costs
+    // ::::: near-linear time and no traversal state. Edge direction is
+    // ::::: ignored; components are ordered by their lowest vertex id.
+    template <typename GraphT>
+    static std::vector<std::vector<int>> findConnectedComponentsUnionFind(const GraphT& graph) {
+        int n = graph.getNumVertices();
+        std::vector<int> parent(n);
+        std::vector<int> rank(n, 0);
+        for (int v = 0; v < n; ++v) {
+            parent[v] = v;
+        }
+
+        // ::::: Find with full path compression (iterative)
+        auto findRoot = [&](int v) {
+            int root = v;
+            while (parent[root] != root) {
+                root = parent[root];
+            }
+            while (parent[v] != root) {
+                int next = parent[v];
+                parent[v] = root;
+                v = next;
+            }
+            return root;
+        };
+
+        for (int v = 0; v < n; ++v) {
+            for (const auto& neighbor : graph.getNeighbors(v)) {
+                int rootA = findRoot(v);
+                int rootB = findRoot(neighbor.first);
+                if (rootA == rootB) {
+                    continue;
+                }
+                if (rank[rootA] < rank[rootB]) {
+                    std::swap(rootA, rootB);
+                }
+                parent[rootB] = rootA;
+                if (rank[rootA] == rank[rootB]) {
+                    rank[rootA]++;
+                }
+            }
+        }
+
+        // ::::: Group vertices by root, keyed by each root's first appearance
+        std::vector<int> componentIndex(n, -1);
+        std::vector<std::vector<int>> components;
+        for (int v = 0; v < n; ++v) {
+            int root = findRoot(v);
+            if (componentIndex[root] == -1) {
+                componentIndex[root] = static_cast<int>(components.size());
+                components.emplace_back();
+            }
+            components[componentIndex[root]].push_back(v);
+        }
+
         return components;
     }
-}; 
\ No newline at end of file
+};
\ No newline at end of file
@@ -0,0 +1,156 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "graph.h"
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+// ::::: Immutable compressed sparse row (CSR) graph.
+// ::::: Adjacency is stored in two contiguous arrays (per-vertex offsets and a
+// ::::: flat edge array), so iterating the neighbors of a vertex is a linear
+// ::::: scan instead of a hash lookup plus pointer chase. The accessor surface
+// ::::: mirrors Graph so the algorithm classes can accept either representation.
+class CSRGraph {
+private:
+    std::vector<size_t> offsets;                    // ::::: Size numVertices + 1
+    std::vector<std::pair<int, double>> edges;      // ::::: Flat (target, weight) entries
+    int numVertices;
+    size_t numEdges;
+    bool isDirected;
+
+public:
+    // ::::: Lightweight view over one vertex's slice of the edge array.
+    // ::::: Supports range-for and indexing like the vector Graph returns.
+    class NeighborRange {
+    private:
+        const std::pair<int, double>* first;
+        const std::pair<int, double>* last;
+
+    public:
+        NeighborRange(const std::pair<int, double>* begin, const std::pair<int, double>* end)
+            : first(begin), last(end) {}
+
+        const std::pair<int, double>* begin() const { return first; }
+        const std::pair<int, double>* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+        const std::pair<int, double>& operator[](size_t i) const { return first[i]; }
+    };
+
+    // ::::: Build from a flat edge list. Vertex ids must be non-negative and
+    // ::::: index the graph densely (the same assumption the algorithms make).
+    CSRGraph(int vertexCount, const std::vector<std::pair<int, std::pair<int, double>>>& edgeList,
+             bool directed = false)
+        : numVertices(vertexCount), numEdges(0), isDirected(directed) {
+        if (vertexCount < 0) {
+            throw std::invalid_argument("Vertex count cannot be negative");
+        }
+
+        // ::::: Count per-vertex degrees (both directions for undirected graphs)
+        std::vector<size_t> degrees(numVertices, 0);
+        for (const auto& [from, edge] : edgeList) {
+            if (from < 0 || from >= numVertices || edge.first < 0 || edge.first >= numVertices) {
+                throw std::out_of_range("Edge endpoint out of range");
+            }
+            degrees[from]++;
+            if (!directed) {
+                degrees[edge.first]++;
+            }
+        }
+
+        // ::::: Prefix-sum degrees into offsets
+        offsets.resize(numVertices + 1, 0);
+        for (int v = 0; v < numVertices; ++v) {
+            offsets[v + 1] = offsets[v] + degrees[v];
+        }
+
+        // ::::: Scatter edges into their slots
+        edges.resize(offsets[numVertices]);
+        std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (const auto& [from, edge] : edgeList) {
+            edges[cursor[from]++] = edge;
+            if (!directed) {
+                edges[cursor[edge.first]++] = {from, edge.second};
+            }
+        }
+
+        // ::::: Sort each adjacency slice so lookups can binary search
+        for (int v = 0; v < numVertices; ++v) {
+            std::sort(edges.begin() + offsets[v], edges.begin() + offsets[v + 1]);
+        }
+
+        numEdges = edgeList.size();
+    }
+
+    // ::::: Convert the mutable hash-map Graph into CSR form
+    static CSRGraph fromGraph(const Graph& graph) {
+        int n = graph.getNumVertices();
+        std::vector<std::pair<int, std::pair<int, double>>> edgeList;
+
+        for (int v : graph.getVertices()) {
+            n = std::max(n, v + 1);
+            for (const auto& [to, weight] : graph.getNeighbors(v)) {
+                // ::::: Undirected Graph stores each edge twice; keep one copy
+                if (!graph.isDirectedGraph() && to < v) {
+                    continue;
+                }
+                edgeList.push_back({v, {to, weight}});
+            }
+        }
+
+        return CSRGraph(n, edgeList, graph.isDirectedGraph());
+    }
+
+    NeighborRange getNeighbors(int vertex) const {
+        if (vertex < 0 || vertex >= numVertices) {
+            return NeighborRange(nullptr, nullptr);
+        }
+        return NeighborRange(edges.data() + offsets[vertex],
+                             edges.data() + offsets[vertex + 1]);
+    }
+
+    bool hasVertex(int vertex) const {
+        return vertex >= 0 && vertex < numVertices;
+    }
+
+    bool hasEdge(int from, int to) const {
+        if (!hasVertex(from) || !hasVertex(to)) return false;
+        auto range = getNeighbors(from);
+        auto it = std::lower_bound(range.begin(), range.end(), to,
+                                   [](const auto& p, int target) { return p.first < target; });
+        return it != range.end() && it->first == to;
+    }
+
+    double getEdgeWeight(int from, int to) const {
+        if (!hasVertex(from)) {
+            throw std::invalid_argument("Source vertex not found");
+        }
+        auto range = getNeighbors(from);
+        auto it = std::lower_bound(range.begin(), range.end(), to,
+                                   [](const auto& p, int target) { return p.first < target; });
+        if (it == range.end() || it->first != to) {
+            throw std::invalid_argument("Edge not found");
+        }
+        return it->second;
+    }
+
+    std::vector<int> getVertices() const {
+        std::vector<int> result(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            result[v] = v;
+        }
+        return result;
+    }
+
+    int getNumVertices() const { return numVertices; }
+    int getNumEdges() const { return static_cast<int>(numEdges); }
+    bool isDirectedGraph() const { return isDirected; }
+
+    // ::::: Raw array access for serialization (see graph_io.h)
+    const std::vector<size_t>& getOffsets() const { return offsets; }
+    const std::vector<std::pair<int, double>>& getEdgeArray() const { return edges; }
+};
+
+#endif
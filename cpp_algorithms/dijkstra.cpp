@@ -5,6 +5,9 @@
 #include <unordered_map>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
+#include <atomic>
+#include <mutex>
 
 class Dijkstra {
 public:
@@ -25,7 +28,8 @@ public:
         }
     };
 
-    static Result shortestPath(const Graph& graph, int startVertex) {
+    template <typename GraphT>
+    static Result shortestPath(const GraphT& graph, int startVertex) {
         if (!graph.hasVertex(startVertex)) {
             throw std::invalid_argument("Start vertex does not exist in the graph");
         }
@@ -68,6 +72,125 @@ public:
         return {distances, previous};
     }
 
+    // ::::: One batched distance query: a source and the set of targets
+    // ::::: whose distances the caller actually needs
+    struct Query {
+        int source;
+        std::vector<int> targets;
+    };
+
+    // ::::: Single-source Dijkstra that stops as soon as every requested
+    // ::::: target is settled, instead of flooding the whole graph. Returns
+    // ::::: distances aligned with the targets vector (infinity = no path).
+    template <typename GraphT>
+    static std::vector<double> shortestPathToTargets(const GraphT& graph, int startVertex,
+                                                     const std::vector<int>& targets) {
+        if (!graph.hasVertex(startVertex)) {
+            throw std::invalid_argument("Start vertex does not exist in the graph");
+        }
+
+        size_t n = static_cast<size_t>(graph.getNumVertices());
+        std::vector<char> unsettledTarget(n, 0);
+        size_t remaining = 0;
+        for (int target : targets) {
+            if (target < 0 || static_cast<size_t>(target) >= n) {
+                throw std::invalid_argument("Target vertex does not exist in the graph");
+            }
+            if (!unsettledTarget[target]) {
+                unsettledTarget[target] = 1;
+                remaining++;
+            }
+        }
+
+        std::vector<double> distances(n, std::numeric_limits<double>::infinity());
+        std::priority_queue<std::pair<double, int>,
+                          std::vector<std::pair<double, int>>,
+                          std::greater<std::pair<double, int>>> pq;
+
+        distances[startVertex] = 0.0;
+        pq.push({0.0, startVertex});
+
+        while (!pq.empty() && remaining > 0) {
+            int current = pq.top().second;
+            double currentDist = pq.top().first;
+            pq.pop();
+
+            if (currentDist > distances[current]) continue;
+
+            // ::::: A popped vertex is settled; stop once the last target is
+            if (unsettledTarget[current]) {
+                unsettledTarget[current] = 0;
+                if (--remaining == 0) break;
+            }
+
+            for (const auto& [next, weight] : graph.getNeighbors(current)) {
+                if (weight < 0) {
+                    throw std::runtime_error("Negative edge weights are not allowed in Dijkstra's algorithm");
+                }
+
+                double newDist = distances[current] + weight;
+                if (newDist < distances[next]) {
+                    distances[next] = newDist;
+                    pq.push({newDist, next});
+                }
+            }
+        }
+
+        std::vector<double> result;
+        result.reserve(targets.size());
+        for (int target : targets) {
+            result.push_back(distances[target]);
+        }
+        return result;
+    }
+
+    // ::::: Run many (source, target-set) queries over the shared read-only
+    // ::::: graph across a pool of worker threads, each pulling the next
+    // ::::: query off an atomic counter. results[i] aligns with queries[i],
+    // ::::: and the whole batch is returned in one block so callers amortize
+    // ::::: graph load over thousands of queries.
+    template <typename GraphT>
+    static std::vector<std::vector<double>> batchShortestPaths(const GraphT& graph,
+                                                               const std::vector<Query>& queries,
+                                                               int numThreads = 0) {
+        if (numThreads < 0) {
+            throw std::invalid_argument("Thread count cannot be negative");
+        }
+        if (numThreads == 0) {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        std::vector<std::vector<double>> results(queries.size());
+        std::atomic<size_t> nextQuery{0};
+        std::exception_ptr firstError = nullptr;
+        std::mutex errorMutex;
+
+        int threads = std::max(1, std::min<int>(numThreads, static_cast<int>(queries.size())));
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&]() {
+                for (size_t i = nextQuery.fetch_add(1); i < queries.size();
+                     i = nextQuery.fetch_add(1)) {
+                    try {
+                        results[i] = shortestPathToTargets(graph, queries[i].source,
+                                                           queries[i].targets);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!firstError) firstError = std::current_exception();
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+        return results;
+    }
+
     static std::vector<int> getPath(const Result& result, int endVertex) {
         if (endVertex < 0 || static_cast<size_t>(endVertex) >= result.distances.size()) {
             throw std::invalid_argument("Invalid end vertex");
@@ -85,7 +208,8 @@ public:
         return path;
     }
     
-    static std::string getPathDescription(const Graph& graph, const Result& result, int endVertex) {
+    template <typename GraphT>
+    static std::string getPathDescription(const GraphT& graph, const Result& result, int endVertex) {
         std::vector<int> path = getPath(result, endVertex);
         if (path.empty()) {
             return "No path exists to the target vertex";
@@ -108,7 +232,8 @@ public:
         return oss.str();
     }
     
-    static std::vector<std::vector<int>> getAllShortestPaths(const Graph& graph, int startVertex) {
+    template <typename GraphT>
+    static std::vector<std::vector<int>> getAllShortestPaths(const GraphT& graph, int startVertex) {
         Result result = shortestPath(graph, startVertex);
         std::vector<std::vector<int>> allPaths;
         
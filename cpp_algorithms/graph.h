@@ -63,6 +63,65 @@ public:
         }
     }
 
+    // ::::: Bulk-load path: append the edge without scanning for duplicates.
+    // ::::: Callers must run finalizeEdges() before querying the graph.
+    void addEdgeUnchecked(int from, int to, double weight = 1.0) {
+        if (from < 0 || to < 0) {
+            throw std::invalid_argument("Vertex IDs cannot be negative");
+        }
+        if (weight < 0) {
+            throw std::invalid_argument("Weight cannot be negative");
+        }
+
+        addVertex(from);
+        addVertex(to);
+
+        adjList[from].push_back({to, weight});
+        if (!isDirected) {
+            adjList[to].push_back({from, weight});
+        }
+    }
+
+    // ::::: Sort each adjacency list and collapse duplicate targets in one
+    // ::::: pass. The last inserted weight wins, matching addEdge semantics.
+    void finalizeEdges() {
+        for (auto& [_, neighbors] : adjList) {
+            std::stable_sort(neighbors.begin(), neighbors.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            size_t out = 0;
+            for (size_t i = 0; i < neighbors.size(); ++i) {
+                // ::::: Skip to the last entry of each run of equal targets
+                if (i + 1 < neighbors.size() && neighbors[i + 1].first == neighbors[i].first) {
+                    continue;
+                }
+                neighbors[out++] = neighbors[i];
+            }
+            neighbors.resize(out);
+        }
+    }
+
+    // ::::: Remove an edge if present; returns whether it existed. The
+    // ::::: vertices themselves stay in the graph.
+    bool removeEdge(int from, int to) {
+        auto erase = [this](int source, int target) {
+            auto it = adjList.find(source);
+            if (it == adjList.end()) return false;
+            auto& neighbors = it->second;
+            auto edgeIt = std::find_if(neighbors.begin(), neighbors.end(),
+                                       [target](const auto& p) { return p.first == target; });
+            if (edgeIt == neighbors.end()) return false;
+            neighbors.erase(edgeIt);
+            return true;
+        };
+
+        bool existed = erase(from, to);
+        if (!isDirected && existed) {
+            erase(to, from);
+        }
+        return existed;
+    }
+
     const std::vector<std::pair<int, double>>& getNeighbors(int vertex) const {
         static const std::vector<std::pair<int, double>> empty;
         auto it = adjList.find(vertex);
@@ -1,4 +1,8 @@
 #include "graph.h"
+#include "csr_graph.h"
+#include "compact_graph.h"
+#include "edge_list_reader.h"
+#include "arena_allocator.h"
 #include <vector>
 #include <unordered_map>
 #include <fstream>
@@ -11,27 +15,244 @@ public:
     // ::::: Build a graph from an edge list file
     static Graph buildFromEdgeList(const std::string& filename, bool directed = false) {
         Graph graph(directed);
+
+        for (const auto& edge : EdgeListReader::read(filename)) {
+            if (edge.from < 0 || edge.to < 0) {
+                throw std::invalid_argument("Vertex IDs cannot be negative");
+            }
+            graph.addEdgeUnchecked(edge.from, edge.to, edge.weight);
+        }
+
+        // ::::: One sort/dedup pass instead of a linear scan per insert
+        graph.finalizeEdges();
+        return graph;
+    }
+    
+    // ::::: Build an immutable CSR graph directly from an edge list file,
+    // ::::: skipping the intermediate hash-map representation entirely
+    static CSRGraph buildCSRFromEdgeList(const std::string& filename, bool directed = false) {
+        std::vector<std::pair<int, std::pair<int, double>>> edges;
+        int maxVertex = -1;
+        for (const auto& edge : EdgeListReader::read(filename)) {
+            if (edge.from < 0 || edge.to < 0) {
+                throw std::invalid_argument("Vertex IDs cannot be negative");
+            }
+            edges.push_back({edge.from, {edge.to, edge.weight}});
+            maxVertex = std::max({maxVertex, edge.from, edge.to});
+        }
+
+        return CSRGraph(maxVertex + 1, edges, directed);
+    }
+
+    // ::::: Freeze an already-built Graph into CSR form
+    static CSRGraph buildCSRFromGraph(const Graph& graph) {
+        return CSRGraph::fromGraph(graph);
+    }
+
+    // ::::: Build the compact (uint32/float) CSR layout straight from an edge
+    // ::::: list file; storeWeights false drops the weight column entirely
+    static CompactGraph buildCompactFromEdgeList(const std::string& filename,
+                                                 bool directed = false,
+                                                 bool storeWeights = true) {
+        std::vector<std::pair<int, std::pair<int, double>>> edges;
+        int maxVertex = -1;
+        for (const auto& edge : EdgeListReader::read(filename)) {
+            if (edge.from < 0 || edge.to < 0) {
+                throw std::invalid_argument("Vertex IDs cannot be negative");
+            }
+            edges.push_back({edge.from, {edge.to, edge.weight}});
+            maxVertex = std::max({maxVertex, edge.from, edge.to});
+        }
+
+        return CompactGraph(maxVertex + 1, edges, directed, storeWeights);
+    }
+
+    // ::::: Freeze an already-built Graph into the compact layout
+    static CompactGraph buildCompactFromGraph(const Graph& graph, bool storeWeights = true) {
+        return CompactGraph::fromGraph(graph, storeWeights);
+    }
+
+    // ::::: An hourly crawler batch: edges to add and edges to drop
+    struct EdgeDelta {
+        std::vector<std::pair<int, std::pair<int, double>>> additions;
+        std::vector<std::pair<int, int>> removals;
+    };
+
+    // ::::: Read an edge-delta file: one change per line, '+ src dst [weight]'
+    // ::::: to add (weight defaults to 1.0) or '- src dst' to remove; lines
+    // ::::: starting with '#' are comments
+    static EdgeDelta readEdgeDelta(const std::string& filename) {
         std::ifstream file(filename);
-        
+
         if (!file.is_open()) {
             throw std::runtime_error("Could not open file: " + filename);
         }
-        
+
+        EdgeDelta delta;
         std::string line;
         while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+
             std::istringstream iss(line);
+            char op;
             int from, to;
             double weight = 1.0;
-            
-            if (iss >> from >> to) {
+
+            if (!(iss >> op >> from >> to) || (op != '+' && op != '-')) {
+                throw std::invalid_argument("Invalid delta line: " + line);
+            }
+            if (from < 0 || to < 0) {
+                throw std::invalid_argument("Vertex IDs cannot be negative");
+            }
+
+            if (op == '+') {
                 iss >> weight; // ::::: Optional weight
-                graph.addEdge(from, to, weight);
+                delta.additions.push_back({from, {to, weight}});
+            } else {
+                delta.removals.push_back({from, to});
             }
         }
-        
-        return graph;
+
+        return delta;
     }
-    
+
+    // ::::: Apply a delta to an existing Graph in place, instead of re-reading
+    // ::::: the full edge list. Removals of absent edges are ignored.
+    static void applyEdgeDelta(Graph& graph, const EdgeDelta& delta) {
+        for (const auto& [from, to] : delta.removals) {
+            graph.removeEdge(from, to);
+        }
+        for (const auto& edge : delta.additions) {
+            graph.addEdge(edge.first, edge.second.first, edge.second.second);
+        }
+    }
+
+    // ::::: Old/new id mapping produced by a reordering pass. GitHub user ids
+    // ::::: are sparse and essentially random, so the new ids are dense
+    // ::::: 0..n-1 and chosen for cache locality; keep the mapping around to
+    // ::::: translate results back to the original ids on output.
+    struct VertexOrdering {
+        std::vector<int> newToOld;
+        std::unordered_map<int, int> oldToNew;
+
+        int toNew(int oldVertex) const {
+            auto it = oldToNew.find(oldVertex);
+            if (it == oldToNew.end()) {
+                throw std::invalid_argument("Vertex not in ordering");
+            }
+            return it->second;
+        }
+
+        int toOld(int newVertex) const {
+            if (newVertex < 0 || newVertex >= static_cast<int>(newToOld.size())) {
+                throw std::invalid_argument("Vertex not in ordering");
+            }
+            return newToOld[newVertex];
+        }
+    };
+
+    // ::::: Degree-sorted ordering: highest-degree vertices first, so the hub
+    // ::::: scores that iterative kernels touch most often share cache lines
+    static VertexOrdering computeDegreeOrdering(const Graph& graph) {
+        std::vector<int> order = graph.getVertices();
+        std::stable_sort(order.begin(), order.end(),
+                         [&graph](int a, int b) {
+                             return graph.getNeighbors(a).size() > graph.getNeighbors(b).size();
+                         });
+        return buildOrdering(order);
+    }
+
+    // ::::: Cuthill-McKee ordering: BFS from a low-degree seed per component,
+    // ::::: visiting neighbors in ascending degree order, then reversed (RCM).
+    // ::::: Neighboring vertices end up with nearby ids, which keeps the
+    // ::::: score-array accesses in PageRank/HITS close together.
+    static VertexOrdering computeRCMOrdering(const Graph& graph) {
+        std::vector<int> vertices = graph.getVertices();
+        size_t n = vertices.size();
+
+        // ::::: Dense scratch index so the per-vertex state is flat arrays
+        std::unordered_map<int, int> denseIndex;
+        denseIndex.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            denseIndex[vertices[i]] = static_cast<int>(i);
+        }
+
+        // ::::: Directed adjacency is one-sided; BFS needs both directions.
+        // ::::: The per-vertex scratch lists come from an arena released in
+        // ::::: one shot when the pass ends.
+        MemoryArena arena;
+        using ArenaIntVector = std::vector<int, ArenaAllocator<int>>;
+        std::vector<ArenaIntVector> undirected(n, ArenaIntVector(ArenaAllocator<int>(arena)));
+        for (size_t i = 0; i < n; ++i) {
+            for (const auto& neighbor : graph.getNeighbors(vertices[i])) {
+                int j = denseIndex[neighbor.first];
+                undirected[i].push_back(j);
+                if (graph.isDirectedGraph()) {
+                    undirected[j].push_back(static_cast<int>(i));
+                }
+            }
+        }
+
+        auto degree = [&undirected](int v) { return undirected[v].size(); };
+
+        // ::::: Seed each component from its lowest-degree vertex
+        std::vector<int> seeds(n);
+        for (size_t i = 0; i < n; ++i) seeds[i] = static_cast<int>(i);
+        std::stable_sort(seeds.begin(), seeds.end(),
+                         [&degree](int a, int b) { return degree(a) < degree(b); });
+
+        std::vector<int> order;
+        order.reserve(n);
+        std::vector<char> visited(n, 0);
+        for (int seed : seeds) {
+            if (visited[seed]) continue;
+            visited[seed] = 1;
+
+            std::queue<int> frontier;
+            frontier.push(seed);
+            while (!frontier.empty()) {
+                int current = frontier.front();
+                frontier.pop();
+                order.push_back(vertices[current]);
+
+                std::vector<int> next;
+                for (int neighbor : undirected[current]) {
+                    if (!visited[neighbor]) {
+                        visited[neighbor] = 1;
+                        next.push_back(neighbor);
+                    }
+                }
+                std::stable_sort(next.begin(), next.end(),
+                                 [&degree](int a, int b) { return degree(a) < degree(b); });
+                for (int neighbor : next) {
+                    frontier.push(neighbor);
+                }
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+        return buildOrdering(order);
+    }
+
+    // ::::: Rebuild the graph with the new dense ids. Weights and direction
+    // ::::: carry over unchanged.
+    static Graph relabelGraph(const Graph& graph, const VertexOrdering& ordering) {
+        Graph relabeled(graph.isDirectedGraph());
+
+        for (int newVertex = 0; newVertex < static_cast<int>(ordering.newToOld.size()); ++newVertex) {
+            int oldVertex = ordering.newToOld[newVertex];
+            relabeled.addVertex(newVertex);
+            for (const auto& [to, weight] : graph.getNeighbors(oldVertex)) {
+                // ::::: Undirected adjacency lists both directions; keep one
+                if (!graph.isDirectedGraph() && to < oldVertex) continue;
+                relabeled.addEdgeUnchecked(newVertex, ordering.toNew(to), weight);
+            }
+        }
+
+        relabeled.finalizeEdges();
+        return relabeled;
+    }
+
     // ::::: Build a graph from an adjacency matrix
     static Graph buildFromAdjacencyMatrix(const std::vector<std::vector<double>>& matrix, bool directed = false) {
         Graph graph(directed);
@@ -146,4 +367,16 @@ public:
         
         return graph;
     }
+
+private:
+    // ::::: Pack an ordered vertex list into the old/new mapping
+    static VertexOrdering buildOrdering(const std::vector<int>& order) {
+        VertexOrdering ordering;
+        ordering.newToOld = order;
+        ordering.oldToNew.reserve(order.size());
+        for (size_t newVertex = 0; newVertex < order.size(); ++newVertex) {
+            ordering.oldToNew[order[newVertex]] = static_cast<int>(newVertex);
+        }
+        return ordering;
+    }
 };
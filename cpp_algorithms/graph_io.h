@@ -0,0 +1,209 @@
+#ifndef GRAPH_IO_H
+#define GRAPH_IO_H
+
+#include "csr_graph.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ::::: Compact binary on-disk graph format.
+// ::::: Layout: fixed header, then the CSR offset array, then the flat
+// ::::: (target, weight) edge array exactly as CSRGraph holds it in memory.
+// ::::: Loading memory-maps the file, so the page cache is shared across
+// ::::: concurrent processes and "parsing" is a pointer fixup.
+struct GraphFileHeader {
+    static constexpr uint32_t MAGIC = 0x47435847; // ::::: "GXCG"
+    static constexpr uint32_t VERSION = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t directed;
+    int32_t numVertices;
+    uint64_t numEdges;       // ::::: Logical edge count (undirected counted once)
+    uint64_t numEntries;     // ::::: Stored adjacency entries (offsets[numVertices])
+};
+
+static_assert(sizeof(std::pair<int, double>) == 16,
+              "Graph file format assumes 16-byte (target, weight) entries");
+
+// ::::: Read-only CSR graph backed by a memory-mapped graph file.
+// ::::: Mirrors the CSRGraph accessor surface so the templated algorithms
+// ::::: run on it unchanged.
+class MappedCSRGraph {
+private:
+    GraphFileHeader header;
+    const size_t* offsets;
+    const std::pair<int, double>* edges;
+
+    // ::::: Either the mmap region or an owned fallback buffer
+    void* mapping;
+    size_t mappingSize;
+    std::vector<char> fallbackBuffer;
+
+    void attach(const char* data, size_t size) {
+        if (size < sizeof(GraphFileHeader)) {
+            throw std::runtime_error("Graph file is truncated");
+        }
+        std::memcpy(&header, data, sizeof(header));
+        if (header.magic != GraphFileHeader::MAGIC) {
+            throw std::runtime_error("Not a graph file (bad magic)");
+        }
+        if (header.version != GraphFileHeader::VERSION) {
+            throw std::runtime_error("Unsupported graph file version");
+        }
+
+        size_t offsetsBytes = (static_cast<size_t>(header.numVertices) + 1) * sizeof(size_t);
+        size_t edgesBytes = header.numEntries * sizeof(std::pair<int, double>);
+        if (size < sizeof(header) + offsetsBytes + edgesBytes) {
+            throw std::runtime_error("Graph file is truncated");
+        }
+
+        offsets = reinterpret_cast<const size_t*>(data + sizeof(header));
+        edges = reinterpret_cast<const std::pair<int, double>*>(data + sizeof(header) + offsetsBytes);
+    }
+
+public:
+    explicit MappedCSRGraph(const std::string& filename)
+        : offsets(nullptr), edges(nullptr), mapping(nullptr), mappingSize(0) {
+#ifndef _WIN32
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open graph file: " + filename);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw std::runtime_error("Could not stat graph file: " + filename);
+        }
+
+        mappingSize = static_cast<size_t>(st.st_size);
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            throw std::runtime_error("Could not mmap graph file: " + filename);
+        }
+
+        try {
+            attach(static_cast<const char*>(mapping), mappingSize);
+        } catch (...) {
+            munmap(mapping, mappingSize);
+            mapping = nullptr;
+            throw;
+        }
+#else
+        // ::::: No mmap on this platform; fall back to one buffered read
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open graph file: " + filename);
+        }
+        fallbackBuffer.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(fallbackBuffer.data(), fallbackBuffer.size());
+        attach(fallbackBuffer.data(), fallbackBuffer.size());
+#endif
+    }
+
+    ~MappedCSRGraph() {
+#ifndef _WIN32
+        if (mapping) {
+            munmap(mapping, mappingSize);
+        }
+#endif
+    }
+
+    MappedCSRGraph(const MappedCSRGraph&) = delete;
+    MappedCSRGraph& operator=(const MappedCSRGraph&) = delete;
+
+    CSRGraph::NeighborRange getNeighbors(int vertex) const {
+        if (vertex < 0 || vertex >= header.numVertices) {
+            return CSRGraph::NeighborRange(nullptr, nullptr);
+        }
+        return CSRGraph::NeighborRange(edges + offsets[vertex], edges + offsets[vertex + 1]);
+    }
+
+    bool hasVertex(int vertex) const {
+        return vertex >= 0 && vertex < header.numVertices;
+    }
+
+    bool hasEdge(int from, int to) const {
+        if (!hasVertex(from) || !hasVertex(to)) return false;
+        for (const auto& [target, _] : getNeighbors(from)) {
+            if (target == to) return true;
+        }
+        return false;
+    }
+
+    double getEdgeWeight(int from, int to) const {
+        if (!hasVertex(from)) {
+            throw std::invalid_argument("Source vertex not found");
+        }
+        for (const auto& [target, weight] : getNeighbors(from)) {
+            if (target == to) return weight;
+        }
+        throw std::invalid_argument("Edge not found");
+    }
+
+    std::vector<int> getVertices() const {
+        std::vector<int> result(header.numVertices);
+        for (int v = 0; v < header.numVertices; ++v) {
+            result[v] = v;
+        }
+        return result;
+    }
+
+    int getNumVertices() const { return header.numVertices; }
+    int getNumEdges() const { return static_cast<int>(header.numEdges); }
+    bool isDirectedGraph() const { return header.directed != 0; }
+};
+
+class GraphFile {
+public:
+    // ::::: Write a CSR graph to the binary format
+    static void save(const CSRGraph& graph, const std::string& filename) {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open output file: " + filename);
+        }
+
+        const auto& offsets = graph.getOffsets();
+        const auto& edges = graph.getEdgeArray();
+
+        GraphFileHeader header;
+        header.magic = GraphFileHeader::MAGIC;
+        header.version = GraphFileHeader::VERSION;
+        header.directed = graph.isDirectedGraph() ? 1 : 0;
+        header.numVertices = graph.getNumVertices();
+        header.numEdges = static_cast<uint64_t>(graph.getNumEdges());
+        header.numEntries = edges.size();
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(offsets.data()),
+                   offsets.size() * sizeof(size_t));
+        file.write(reinterpret_cast<const char*>(edges.data()),
+                   edges.size() * sizeof(std::pair<int, double>));
+
+        if (!file) {
+            throw std::runtime_error("Failed writing graph file: " + filename);
+        }
+    }
+
+    // ::::: Map a binary graph file for read-only access
+    static MappedCSRGraph map(const std::string& filename) {
+        return MappedCSRGraph(filename);
+    }
+};
+
+#endif
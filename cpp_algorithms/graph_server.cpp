@@ -0,0 +1,226 @@
+#include "graph.h"
+#include "csr_graph.h"
+#include "graph_io.h"
+#include "graph_build.cpp"
+#include "bfs_dfs.cpp"
+#include "dijkstra.cpp"
+#include "louvain.cpp"
+#include "kcore.cpp"
+#include "hits.cpp"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iomanip>
+
+// ::::: Long-running analytics server: loads the graph once and answers
+// ::::: algorithm requests over a line-oriented stdin/stdout protocol, so
+// ::::: callers stop paying process startup and graph parse per query.
+// :::::
+// ::::: Protocol (one request per line, response terminated by "END"):
+// :::::   PAGERANK [damping] [max_iterations]
+// :::::   HITS [max_iterations]
+// :::::   BFS <source>
+// :::::   DIJKSTRA <source> [target]
+// :::::   KCORE
+// :::::   LOUVAIN
+// :::::   INFO
+// :::::   QUIT
+class GraphServer {
+private:
+    const CSRGraph& graph;
+
+    // ::::: Push-style PageRank over the resident out-adjacency
+    std::vector<double> computePageRank(double damping, int maxIterations) const {
+        int n = graph.getNumVertices();
+        std::vector<double> scores(n, 1.0 / n);
+        std::vector<double> newScores(n);
+        double baseScore = (1.0 - damping) / n;
+
+        for (int iteration = 0; iteration < maxIterations; ++iteration) {
+            std::fill(newScores.begin(), newScores.end(), baseScore);
+
+            double danglingMass = 0.0;
+            for (int node = 0; node < n; ++node) {
+                auto neighbors = graph.getNeighbors(node);
+                if (neighbors.empty()) {
+                    danglingMass += scores[node];
+                    continue;
+                }
+                double share = damping * scores[node] / neighbors.size();
+                for (const auto& [target, _] : neighbors) {
+                    newScores[target] += share;
+                }
+            }
+
+            double danglingShare = damping * danglingMass / n;
+            double diff = 0.0;
+            for (int node = 0; node < n; ++node) {
+                newScores[node] += danglingShare;
+                diff += std::abs(newScores[node] - scores[node]);
+            }
+
+            scores.swap(newScores);
+            if (diff < 1e-6) {
+                break;
+            }
+        }
+
+        return scores;
+    }
+
+public:
+    explicit GraphServer(const CSRGraph& g) : graph(g) {}
+
+    // ::::: Handle one request line; returns false when the client quit
+    bool handle(const std::string& line, std::ostream& out) const {
+        std::istringstream iss(line);
+        std::string command;
+        if (!(iss >> command)) {
+            return true; // ::::: Ignore blank lines
+        }
+
+        try {
+            if (command == "QUIT") {
+                out << "OK bye\nEND\n";
+                return false;
+            } else if (command == "INFO") {
+                out << "OK vertices=" << graph.getNumVertices()
+                    << " edges=" << graph.getNumEdges()
+                    << " directed=" << (graph.isDirectedGraph() ? 1 : 0) << "\n";
+            } else if (command == "PAGERANK") {
+                double damping = 0.85;
+                int maxIterations = 100;
+                iss >> damping >> maxIterations;
+                auto scores = computePageRank(damping, maxIterations);
+                out << "OK " << scores.size() << "\n";
+                out << std::fixed << std::setprecision(6);
+                for (size_t i = 0; i < scores.size(); ++i) {
+                    out << i << " " << scores[i] << "\n";
+                }
+            } else if (command == "HITS") {
+                int maxIterations = 100;
+                iss >> maxIterations;
+                auto result = HITS::calculate(graph, maxIterations);
+                out << "OK " << result.hubScores.size() << "\n";
+                out << std::fixed << std::setprecision(6);
+                for (size_t i = 0; i < result.hubScores.size(); ++i) {
+                    out << i << " " << result.hubScores[i] << " " << result.authorityScores[i] << "\n";
+                }
+            } else if (command == "BFS") {
+                int source;
+                if (!(iss >> source)) {
+                    throw std::invalid_argument("BFS requires a source vertex");
+                }
+                auto [traversal, distances] = GraphTraversal::bfs(graph, source);
+                out << "OK " << distances.size() << "\n";
+                for (size_t i = 0; i < distances.size(); ++i) {
+                    out << i << " " << distances[i] << "\n";
+                }
+            } else if (command == "DIJKSTRA") {
+                int source, target;
+                if (!(iss >> source)) {
+                    throw std::invalid_argument("DIJKSTRA requires a source vertex");
+                }
+                auto result = Dijkstra::shortestPath(graph, source);
+                if (iss >> target) {
+                    out << "OK 1\n";
+                    if (result.hasPathTo(target)) {
+                        out << target << " " << result.distances[target] << "\n";
+                    } else {
+                        out << target << " inf\n";
+                    }
+                } else {
+                    out << "OK " << result.distances.size() << "\n";
+                    for (size_t i = 0; i < result.distances.size(); ++i) {
+                        if (result.distances[i] == std::numeric_limits<double>::infinity()) {
+                            out << i << " inf\n";
+                        } else {
+                            out << i << " " << result.distances[i] << "\n";
+                        }
+                    }
+                }
+            } else if (command == "KCORE") {
+                auto result = KCore::decompose(graph);
+                out << "OK " << result.coreNumbers.size() << "\n";
+                for (size_t i = 0; i < result.coreNumbers.size(); ++i) {
+                    out << i << " " << result.coreNumbers[i] << "\n";
+                }
+            } else if (command == "LOUVAIN") {
+                auto result = Louvain::detectCommunities(graph);
+                out << "OK " << result.communities.size()
+                    << " communities=" << result.numCommunities
+                    << " modularity=" << result.modularity << "\n";
+                for (size_t i = 0; i < result.communities.size(); ++i) {
+                    out << i << " " << result.communities[i] << "\n";
+                }
+            } else {
+                out << "ERR unknown command: " << command << "\n";
+            }
+        } catch (const std::exception& e) {
+            out << "ERR " << e.what() << "\n";
+        }
+
+        out << "END\n";
+        out.flush();
+        return true;
+    }
+};
+
+int main(int argc, char* argv[]) {
+    try {
+        // ::::: Check command line arguments
+        if (argc < 2) {
+            std::cerr << "Usage: " << argv[0] << " graph_file [directed]" << std::endl;
+            std::cerr << "  graph_file: binary graph (from graph_convert) or text edge list" << std::endl;
+            std::cerr << "  directed: 1 for directed (text edge lists only, default 0)" << std::endl;
+            return 1;
+        }
+
+        std::string graph_file = argv[1];
+        bool directed = argc > 2 && std::stoi(argv[2]) != 0;
+
+        // ::::: Load the graph once; binary files are detected by magic
+        CSRGraph graph = [&]() {
+            std::ifstream probe(graph_file, std::ios::binary);
+            if (!probe.is_open()) {
+                throw std::runtime_error("Could not open graph file: " + graph_file);
+            }
+            uint32_t magic = 0;
+            probe.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            probe.close();
+
+            if (magic == GraphFileHeader::MAGIC) {
+                // ::::: Rebuild CSR arrays from the mapped file once at startup
+                MappedCSRGraph mapped(graph_file);
+                std::vector<std::pair<int, std::pair<int, double>>> edges;
+                for (int v = 0; v < mapped.getNumVertices(); ++v) {
+                    for (const auto& [target, weight] : mapped.getNeighbors(v)) {
+                        if (!mapped.isDirectedGraph() && target < v) {
+                            continue;
+                        }
+                        edges.push_back({v, {target, weight}});
+                    }
+                }
+                return CSRGraph(mapped.getNumVertices(), edges, mapped.isDirectedGraph());
+            }
+            return GraphBuilder::buildCSRFromEdgeList(graph_file, directed);
+        }();
+
+        std::cerr << "graph_server: " << graph.getNumVertices() << " vertices, "
+                  << graph.getNumEdges() << " edges resident; waiting for requests" << std::endl;
+
+        GraphServer server(graph);
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            if (!server.handle(line, std::cout)) {
+                break;
+            }
+        }
+
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
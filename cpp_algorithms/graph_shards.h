@@ -0,0 +1,90 @@
+#ifndef GRAPH_SHARDS_H
+#define GRAPH_SHARDS_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ::::: Sharded execution support for the iterative ranking kernels. The
+// ::::: full-sweep algorithms stream every edge each iteration out of one
+// ::::: shared CSR, so on a two-socket box half the traffic crosses the
+// ::::: interconnect. A shard plan cuts the destination range into
+// ::::: edge-balanced node intervals; each shard's worker thread copies its
+// ::::: slice of the edge arrays into memory it touched first (first-touch
+// ::::: placement keeps the slice on the worker's own socket) and iterates
+// ::::: against it, meeting the other shards at a barrier for the merge step
+// ::::: between iterations. The same plan-and-merge structure is what a
+// ::::: multi-process split needs once the graph outgrows one machine — the
+// ::::: merge step becomes the exchange point.
+class ShardPlan {
+public:
+    // ::::: Cut [0, n) into intervals holding roughly equal slices of the
+    // ::::: cumulative edge counts. offsets is CSR-style, size n + 1.
+    static std::vector<std::pair<int, int>> partition(
+        const std::vector<uint64_t>& offsets, int numShards) {
+        if (offsets.empty()) {
+            throw std::invalid_argument("Offsets cannot be empty");
+        }
+        if (numShards <= 0) {
+            throw std::invalid_argument("Shard count must be positive");
+        }
+
+        int n = static_cast<int>(offsets.size()) - 1;
+        numShards = std::min(numShards, std::max(1, n));
+        uint64_t total = offsets[n];
+
+        std::vector<std::pair<int, int>> ranges;
+        int begin = 0;
+        for (int shard = 0; shard < numShards; ++shard) {
+            uint64_t target = total * (shard + 1) / numShards;
+            int end = shard + 1 == numShards
+                ? n
+                : static_cast<int>(std::upper_bound(offsets.begin() + begin,
+                                                    offsets.end(), target) -
+                                   offsets.begin()) - 1;
+            end = std::max(end, begin);
+            ranges.emplace_back(begin, end);
+            begin = end;
+        }
+        ranges.back().second = n;
+        return ranges;
+    }
+};
+
+// ::::: Reusable barrier for the per-iteration rendezvous between shard
+// ::::: workers (generation counter, so the same barrier serves every
+// ::::: iteration without re-arming)
+class ShardBarrier {
+private:
+    std::mutex mutex;
+    std::condition_variable all_arrived;
+    int expected;
+    int waiting = 0;
+    uint64_t generation = 0;
+
+public:
+    explicit ShardBarrier(int participants) : expected(participants) {
+        if (participants <= 0) {
+            throw std::invalid_argument("Barrier requires at least one participant");
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t arrival_generation = generation;
+        if (++waiting == expected) {
+            waiting = 0;
+            generation++;
+            all_arrived.notify_all();
+        } else {
+            all_arrived.wait(lock, [&]() { return generation != arrival_generation; });
+        }
+    }
+};
+
+#endif
@@ -1,12 +1,53 @@
 #include "graph.h"
+#include "top_k.h"
+#include "graph_shards.h"
+#include "instrumentation.h"
 #include <vector>
+#include <cstdint>
 #include <cmath>
+#include <thread>
+#include <atomic>
 #include <algorithm>
 #include <stdexcept>
 #include <sstream>
 #include <iomanip>
 
 class HITS {
+private:
+    // ::::: Fused L2 normalization and L1 convergence delta in one pass over
+    // ::::: contiguous arrays. Plain indexed loops over raw pointers so the
+    // ::::: compiler can vectorize the multiply/abs/accumulate chains.
+    static double normalizeAndDiff(const std::vector<double>& fresh,
+                                   std::vector<double>& current) {
+        size_t n = fresh.size();
+        const double* freshData = fresh.data();
+        double* currentData = current.data();
+
+        double sumSquares = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            sumSquares += freshData[i] * freshData[i];
+        }
+
+        double diff = 0.0;
+        if (sumSquares < std::numeric_limits<double>::epsilon()) {
+            // ::::: Degenerate case: fall back to the uniform distribution
+            double uniform = 1.0 / n;
+            for (size_t i = 0; i < n; ++i) {
+                diff += std::abs(uniform - currentData[i]);
+                currentData[i] = uniform;
+            }
+        } else {
+            double invNorm = 1.0 / std::sqrt(sumSquares);
+            for (size_t i = 0; i < n; ++i) {
+                double value = freshData[i] * invNorm;
+                diff += std::abs(value - currentData[i]);
+                currentData[i] = value;
+            }
+        }
+
+        return diff;
+    }
+
 public:
     struct Scores {
         std::vector<double> hubScores;
@@ -46,7 +87,8 @@ public:
         }
     };
 
-    static Scores calculate(const Graph& graph,
+    template <typename GraphT>
+    static Scores calculate(const GraphT& graph,
                           int maxIterations = 100,
                           double tolerance = 1e-10) {
         if (!graph.isDirectedGraph()) {
@@ -72,107 +114,242 @@ public:
         int actualIterations = 0;
 
         for (int iter = 0; iter < maxIterations; ++iter) {
-            // ::::: Calculate authority scores
+            // ::::: Authority update: scatter hub mass along out-edges
             std::fill(newAuthScores.begin(), newAuthScores.end(), 0.0);
             for (int i = 0; i < n; ++i) {
+                double hub = hubScores[i];
                 for (const auto& neighbor : graph.getNeighbors(i)) {
-                    newAuthScores[neighbor.first] += hubScores[i];
+                    newAuthScores[neighbor.first] += hub;
                 }
             }
 
-            // ::::: Calculate hub scores
-            std::fill(newHubScores.begin(), newHubScores.end(), 0.0);
+            // ::::: Hub update: gather previous authority mass per vertex
             for (int i = 0; i < n; ++i) {
+                double sum = 0.0;
                 for (const auto& neighbor : graph.getNeighbors(i)) {
-                    newHubScores[i] += authScores[neighbor.first];
+                    sum += authScores[neighbor.first];
                 }
+                newHubScores[i] = sum;
             }
 
-            // ::::: Normalize scores
-            double authSum = 0.0, hubSum = 0.0;
-            for (int i = 0; i < n; ++i) {
-                authSum += newAuthScores[i] * newAuthScores[i];
-                hubSum += newHubScores[i] * newHubScores[i];
+            // ::::: Normalization, in-place update and convergence delta are
+            // ::::: fused into one sweep per score array (was four sweeps)
+            double authDiff = normalizeAndDiff(newAuthScores, authScores);
+            double hubDiff = normalizeAndDiff(newHubScores, hubScores);
+
+            actualIterations = iter + 1;
+            Instrumentation::addSample("hits.delta", authDiff + hubDiff);
+            if (authDiff < tolerance && hubDiff < tolerance) {
+                converged = true;
+                break;
             }
-            
-            // ::::: Handle zero sums 
-            if (authSum < std::numeric_limits<double>::epsilon()) {
-                std::fill(newAuthScores.begin(), newAuthScores.end(), 1.0 / n);
-            } else {
-                authSum = std::sqrt(authSum);
-                for (int i = 0; i < n; ++i) {
-                    newAuthScores[i] /= authSum;
+        }
+
+        Instrumentation::addCount("hits.iterations", actualIterations);
+        // ::::: Two passes over every edge per iteration (scatter + gather)
+        Instrumentation::addCount("hits.edge_traversals",
+                                  2ull * actualIterations * graph.getNumEdges());
+
+        return Scores(hubScores, authScores, actualIterations, converged);
+    }
+
+    // ::::: Sharded mode for multi-socket boxes: node ranges balanced by
+    // ::::: their combined in- plus out-edge counts, one persistent worker
+    // ::::: per shard. Each worker copies its range's slice of the flat in-
+    // ::::: and out-edge arrays into memory it touches first, so the slice
+    // ::::: stays on the worker's own socket, and both score updates become
+    // ::::: gathers into the shard's own node range — no shared writes.
+    // ::::: Shards meet at a barrier for the merge steps: one reduces the
+    // ::::: norm partials so everyone can normalize their range, another
+    // ::::: reduces the convergence deltas.
+    template <typename GraphT>
+    static Scores calculateSharded(const GraphT& graph, int numShards = 0,
+                                   int maxIterations = 100,
+                                   double tolerance = 1e-10) {
+        if (!graph.isDirectedGraph()) {
+            throw std::invalid_argument("HITS algorithm requires a directed graph");
+        }
+        if (maxIterations <= 0) {
+            throw std::invalid_argument("Maximum iterations must be positive");
+        }
+        if (tolerance <= 0.0) {
+            throw std::invalid_argument("Tolerance must be positive");
+        }
+
+        int n = graph.getNumVertices();
+        if (n == 0) {
+            throw std::invalid_argument("Graph is empty");
+        }
+        if (numShards <= 0) {
+            numShards = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        // ::::: Flat out- and in-edge arrays (counting sort, as in KCore)
+        std::vector<uint64_t> outOffsets(n + 1, 0), inOffsets(n + 1, 0);
+        for (int u = 0; u < n; ++u) {
+            outOffsets[u + 1] = graph.getNeighbors(u).size();
+            for (const auto& [v, _] : graph.getNeighbors(u)) {
+                inOffsets[v + 1]++;
+            }
+        }
+        for (int v = 0; v < n; ++v) {
+            outOffsets[v + 1] += outOffsets[v];
+            inOffsets[v + 1] += inOffsets[v];
+        }
+        std::vector<uint32_t> outTargets(outOffsets[n]), inSources(inOffsets[n]);
+        {
+            std::vector<uint64_t> cursor(inOffsets.begin(), inOffsets.end() - 1);
+            for (int u = 0; u < n; ++u) {
+                uint64_t slot = outOffsets[u];
+                for (const auto& [v, _] : graph.getNeighbors(u)) {
+                    outTargets[slot++] = static_cast<uint32_t>(v);
+                    inSources[cursor[v]++] = static_cast<uint32_t>(u);
                 }
             }
-            
-            if (hubSum < std::numeric_limits<double>::epsilon()) {
-                std::fill(newHubScores.begin(), newHubScores.end(), 1.0 / n);
+        }
+
+        // ::::: Both updates sweep a node range, so balance shards by the
+        // ::::: range's total edge work in either direction
+        std::vector<uint64_t> combined(n + 1);
+        for (int v = 0; v <= n; ++v) {
+            combined[v] = inOffsets[v] + outOffsets[v];
+        }
+        auto ranges = ShardPlan::partition(combined, numShards);
+        int shards = static_cast<int>(ranges.size());
+
+        std::vector<double> hubScores(n, 1.0), authScores(n, 1.0);
+        std::vector<double> newHubScores(n), newAuthScores(n);
+        std::vector<double> authSquarePartials(shards), hubSquarePartials(shards);
+        std::vector<double> authDiffPartials(shards), hubDiffPartials(shards);
+        // ::::: Written by shard 0 between barriers, read by everyone after
+        double authSumSquares = 0.0, hubSumSquares = 0.0;
+        int actualIterations = 0;
+        ShardBarrier barrier(shards);
+        std::atomic<bool> done{false};
+
+        // ::::: Mirror normalizeAndDiff over one range given the global norm
+        auto normalizeRange = [&](const std::vector<double>& fresh,
+                                  std::vector<double>& current, double sumSquares,
+                                  int begin, int end) {
+            double diff = 0.0;
+            if (sumSquares < std::numeric_limits<double>::epsilon()) {
+                double uniform = 1.0 / n;
+                for (int v = begin; v < end; ++v) {
+                    diff += std::abs(uniform - current[v]);
+                    current[v] = uniform;
+                }
             } else {
-                hubSum = std::sqrt(hubSum);
-                for (int i = 0; i < n; ++i) {
-                    newHubScores[i] /= hubSum;
+                double invNorm = 1.0 / std::sqrt(sumSquares);
+                for (int v = begin; v < end; ++v) {
+                    double value = fresh[v] * invNorm;
+                    diff += std::abs(value - current[v]);
+                    current[v] = value;
                 }
             }
+            return diff;
+        };
 
-            // ::::: Check convergence
-            double authDiff = 0.0, hubDiff = 0.0;
-            for (int i = 0; i < n; ++i) {
-                authDiff += std::abs(newAuthScores[i] - authScores[i]);
-                hubDiff += std::abs(newHubScores[i] - hubScores[i]);
-            }
+        std::vector<std::thread> pool;
+        for (int s = 0; s < shards; ++s) {
+            pool.emplace_back([&, s]() {
+                auto [rangeBegin, rangeEnd] = ranges[s];
 
-            actualIterations = iter + 1;
-            if (authDiff < tolerance && hubDiff < tolerance) {
-                converged = true;
-                break;
-            }
+                // ::::: Shard-local copies of this range's edge slices
+                uint64_t inBegin = inOffsets[rangeBegin], inEnd = inOffsets[rangeEnd];
+                uint64_t outBegin = outOffsets[rangeBegin], outEnd = outOffsets[rangeEnd];
+                std::vector<uint64_t> localIn(rangeEnd - rangeBegin + 1);
+                std::vector<uint64_t> localOut(rangeEnd - rangeBegin + 1);
+                for (int v = rangeBegin; v <= rangeEnd; ++v) {
+                    localIn[v - rangeBegin] = inOffsets[v] - inBegin;
+                    localOut[v - rangeBegin] = outOffsets[v] - outBegin;
+                }
+                std::vector<uint32_t> localSources(inSources.begin() + inBegin,
+                                                   inSources.begin() + inEnd);
+                std::vector<uint32_t> localTargets(outTargets.begin() + outBegin,
+                                                   outTargets.begin() + outEnd);
+
+                for (int iter = 0; iter < maxIterations; ++iter) {
+                    // ::::: Authority update as a gather over in-edges, hub
+                    // ::::: update as a gather over out-edges; both write only
+                    // ::::: this shard's node range
+                    double authSquares = 0.0, hubSquares = 0.0;
+                    for (int v = rangeBegin; v < rangeEnd; ++v) {
+                        double auth = 0.0;
+                        for (uint64_t e = localIn[v - rangeBegin];
+                             e < localIn[v - rangeBegin + 1]; ++e) {
+                            auth += hubScores[localSources[e]];
+                        }
+                        double hub = 0.0;
+                        for (uint64_t e = localOut[v - rangeBegin];
+                             e < localOut[v - rangeBegin + 1]; ++e) {
+                            hub += authScores[localTargets[e]];
+                        }
+                        newAuthScores[v] = auth;
+                        newHubScores[v] = hub;
+                        authSquares += auth * auth;
+                        hubSquares += hub * hub;
+                    }
+                    authSquarePartials[s] = authSquares;
+                    hubSquarePartials[s] = hubSquares;
+
+                    // ::::: Merge step 1: global norms
+                    barrier.wait();
+                    if (s == 0) {
+                        authSumSquares = 0.0;
+                        hubSumSquares = 0.0;
+                        for (int p = 0; p < shards; ++p) {
+                            authSumSquares += authSquarePartials[p];
+                            hubSumSquares += hubSquarePartials[p];
+                        }
+                    }
+                    barrier.wait();
 
-            authScores = newAuthScores;
-            hubScores = newHubScores;
+                    authDiffPartials[s] = normalizeRange(newAuthScores, authScores,
+                                                         authSumSquares, rangeBegin, rangeEnd);
+                    hubDiffPartials[s] = normalizeRange(newHubScores, hubScores,
+                                                        hubSumSquares, rangeBegin, rangeEnd);
+
+                    // ::::: Merge step 2: global convergence deltas
+                    barrier.wait();
+                    if (s == 0) {
+                        double authDiff = 0.0, hubDiff = 0.0;
+                        for (int p = 0; p < shards; ++p) {
+                            authDiff += authDiffPartials[p];
+                            hubDiff += hubDiffPartials[p];
+                        }
+                        actualIterations = iter + 1;
+                        Instrumentation::addSample("hits.delta", authDiff + hubDiff);
+                        if (authDiff < tolerance && hubDiff < tolerance) {
+                            done.store(true);
+                        }
+                    }
+                    barrier.wait();
+                    if (done.load()) {
+                        break;
+                    }
+                }
+            });
+        }
+        for (auto& worker : pool) {
+            worker.join();
         }
 
-        return Scores(hubScores, authScores, actualIterations, converged);
+        Instrumentation::addCount("hits.iterations", actualIterations);
+        Instrumentation::addCount("hits.edge_traversals",
+                                  2ull * actualIterations * graph.getNumEdges());
+
+        return Scores(hubScores, authScores, actualIterations, done.load());
     }
 
     static std::vector<std::pair<int, double>> getTopHubs(
         const std::vector<double>& hubScores, int k) {
-        if (k <= 0) {
-            throw std::invalid_argument("k must be positive");
-        }
-        
-        std::vector<std::pair<int, double>> ranked;
-        for (size_t i = 0; i < hubScores.size(); ++i) {
-            ranked.push_back({static_cast<int>(i), hubScores[i]});
-        }
-        
-        std::sort(ranked.begin(), ranked.end(),
-                 [](const auto& a, const auto& b) { return a.second > b.second; });
-        
-        size_t topK = std::min(static_cast<size_t>(k), ranked.size());
-        return std::vector<std::pair<int, double>>(
-            ranked.begin(),
-            ranked.begin() + topK
-        );
+        // ::::: Bounded-heap selection; no full-size temporary or O(n log n) sort
+        return TopK::select(hubScores, k);
     }
 
     static std::vector<std::pair<int, double>> getTopAuthorities(
         const std::vector<double>& authScores, int k) {
-        if (k <= 0) {
-            throw std::invalid_argument("k must be positive");
-        }
-        
-        std::vector<std::pair<int, double>> ranked;
-        for (size_t i = 0; i < authScores.size(); ++i) {
-            ranked.push_back({static_cast<int>(i), authScores[i]});
-        }
-        
-        std::sort(ranked.begin(), ranked.end(),
-                 [](const auto& a, const auto& b) { return a.second > b.second; });
-        
-        size_t topK = std::min(static_cast<size_t>(k), ranked.size());
-        return std::vector<std::pair<int, double>>(
-            ranked.begin(),
-            ranked.begin() + topK
-        );
+        // ::::: Bounded-heap selection; no full-size temporary or O(n log n) sort
+        return TopK::select(authScores, k);
     }
 }; 
\ No newline at end of file
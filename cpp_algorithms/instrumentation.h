@@ -0,0 +1,127 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ::::: Lightweight run instrumentation behind a --stats flag. When a
+// ::::: nightly run is slow the binaries previously printed only convergence
+// ::::: messages, with no way to attribute the time to parse vs. compute vs.
+// ::::: I/O. Stage timers, hot-path counters and per-iteration series are
+// ::::: recorded into a process-wide registry and dumped as one JSON object;
+// ::::: everything short-circuits on a single bool when stats are off, so
+// ::::: the instrumented loops pay one predictable branch.
+class Instrumentation {
+private:
+    // ::::: Ordered maps so the JSON output is stable across runs
+    std::map<std::string, double> timers;
+    std::map<std::string, uint64_t> counters;
+    std::map<std::string, std::vector<double>> series;
+    std::mutex mutex;
+    bool enabled = false;
+
+    static Instrumentation& instance() {
+        static Instrumentation registry;
+        return registry;
+    }
+
+public:
+    static void enable(bool on = true) { instance().enabled = on; }
+    static bool isEnabled() { return instance().enabled; }
+
+    // ::::: Accumulate elapsed seconds under a stage name
+    static void addTime(const std::string& name, double seconds) {
+        if (!instance().enabled) return;
+        std::lock_guard<std::mutex> lock(instance().mutex);
+        instance().timers[name] += seconds;
+    }
+
+    // ::::: Accumulate a hot-path counter (edge traversals, moves, ...)
+    static void addCount(const std::string& name, uint64_t delta) {
+        if (!instance().enabled) return;
+        std::lock_guard<std::mutex> lock(instance().mutex);
+        instance().counters[name] += delta;
+    }
+
+    // ::::: Append one sample to a per-iteration series (convergence deltas)
+    static void addSample(const std::string& name, double value) {
+        if (!instance().enabled) return;
+        std::lock_guard<std::mutex> lock(instance().mutex);
+        instance().series[name].push_back(value);
+    }
+
+    static void reset() {
+        std::lock_guard<std::mutex> lock(instance().mutex);
+        instance().timers.clear();
+        instance().counters.clear();
+        instance().series.clear();
+    }
+
+    // ::::: One JSON object: {"timers_seconds": {...}, "counters": {...},
+    // ::::: "series": {...}}
+    static std::string toJson() {
+        std::lock_guard<std::mutex> lock(instance().mutex);
+        std::ostringstream oss;
+        oss.precision(9);
+
+        oss << "{\"timers_seconds\": {";
+        bool first = true;
+        for (const auto& [name, seconds] : instance().timers) {
+            oss << (first ? "" : ", ") << "\"" << name << "\": " << seconds;
+            first = false;
+        }
+        oss << "}, \"counters\": {";
+        first = true;
+        for (const auto& [name, count] : instance().counters) {
+            oss << (first ? "" : ", ") << "\"" << name << "\": " << count;
+            first = false;
+        }
+        oss << "}, \"series\": {";
+        first = true;
+        for (const auto& [name, values] : instance().series) {
+            oss << (first ? "" : ", ") << "\"" << name << "\": [";
+            for (size_t i = 0; i < values.size(); ++i) {
+                oss << (i ? ", " : "") << values[i];
+            }
+            oss << "]";
+            first = false;
+        }
+        oss << "}}";
+
+        return oss.str();
+    }
+
+    // ::::: Scoped stage timer: construction to destruction is one stage
+    class ScopedTimer {
+    private:
+        std::string name;
+        std::chrono::steady_clock::time_point start;
+        bool active;
+
+    public:
+        explicit ScopedTimer(const std::string& stageName)
+            : name(stageName), active(Instrumentation::isEnabled()) {
+            if (active) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~ScopedTimer() {
+            if (active) {
+                Instrumentation::addTime(
+                    name, std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - start).count());
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+    };
+};
+
+#endif
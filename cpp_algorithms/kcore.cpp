@@ -1,5 +1,7 @@
 #include "graph.h"
+#include "instrumentation.h"
 #include <vector>
+#include <cstdint>
 #include <queue>
 #include <algorithm>
 #include <stdexcept>
@@ -32,56 +34,280 @@ public:
         }
     };
 
-    static Result decompose(const Graph& graph) {
+    template <typename GraphT>
+    static Result decompose(const GraphT& graph) {
         int n = graph.getNumVertices();
         if (n == 0) throw std::invalid_argument("Graph is empty");
 
-        // ::::: Initialize in-neighbors
-        std::vector<std::unordered_set<int>> inNeighbors(n);
+        // ::::: Flat CSR-style in-neighbor arrays (counting sort, no hash sets)
+        std::vector<int> inOffsets(n + 1, 0);
+        size_t totalEdges = 0;
         for (int u = 0; u < n; ++u) {
             for (const auto& [v, _] : graph.getNeighbors(u)) {
-                inNeighbors[v].insert(u);
+                inOffsets[v + 1]++;
+                totalEdges++;
+            }
+        }
+        for (int v = 0; v < n; ++v) {
+            inOffsets[v + 1] += inOffsets[v];
+        }
+        std::vector<int> inNeighbors(totalEdges);
+        {
+            std::vector<int> cursor(inOffsets.begin(), inOffsets.end() - 1);
+            for (int u = 0; u < n; ++u) {
+                for (const auto& [v, _] : graph.getNeighbors(u)) {
+                    inNeighbors[cursor[v]++] = u;
+                }
             }
         }
 
-        // ::::: Initialize degrees and core numbers
-        std::vector<int> inDegrees(n), outDegrees(n), coreNumbers(n);
+        // ::::: Peeling degree is min(in, out), matching the previous semantics
+        std::vector<int> inDegrees(n), outDegrees(n), degrees(n);
+        int maxDegree = 0;
         for (int v = 0; v < n; ++v) {
-            inDegrees[v] = inNeighbors[v].size();
-            outDegrees[v] = graph.getNeighbors(v).size();
-            coreNumbers[v] = std::min(inDegrees[v], outDegrees[v]);
+            inDegrees[v] = inOffsets[v + 1] - inOffsets[v];
+            outDegrees[v] = static_cast<int>(graph.getNeighbors(v).size());
+            degrees[v] = std::min(inDegrees[v], outDegrees[v]);
+            maxDegree = std::max(maxDegree, degrees[v]);
         }
 
-        // ::::: Process vertices in non-decreasing order of degree
-        bool changed = true;
-        while (changed) {
-            changed = false;
+        // ::::: Batagelj-Zaversnik bin sort: vertices ordered by degree with
+        // ::::: per-bucket start indices, so each degree drop is an O(1) swap
+        std::vector<int> binStart(maxDegree + 2, 0);
+        for (int v = 0; v < n; ++v) {
+            binStart[degrees[v] + 1]++;
+        }
+        for (int d = 0; d <= maxDegree; ++d) {
+            binStart[d + 1] += binStart[d];
+        }
+        std::vector<int> vert(n), pos(n);
+        {
+            std::vector<int> cursor(binStart.begin(), binStart.end() - 1);
             for (int v = 0; v < n; ++v) {
-                int minDegree = std::min(inDegrees[v], outDegrees[v]);
-                if (minDegree < coreNumbers[v]) {
-                    coreNumbers[v] = minDegree;
-                    changed = true;
-
-                    // ::::: Update out-neighbors
-                    for (const auto& [u, _] : graph.getNeighbors(v)) {
-                        if (inDegrees[u] > minDegree) {
-                            inDegrees[u]--;
-                        }
+                pos[v] = cursor[degrees[v]];
+                vert[pos[v]] = v;
+                cursor[degrees[v]]++;
+            }
+        }
+
+        // ::::: Move a vertex one bucket down after its degree dropped by one
+        uint64_t degreeDecrements = 0;
+        auto lowerDegree = [&](int u) {
+            ++degreeDecrements;
+            int du = degrees[u];
+            int firstInBin = binStart[du];
+            int w = vert[firstInBin];
+            if (u != w) {
+                std::swap(vert[pos[u]], vert[firstInBin]);
+                std::swap(pos[u], pos[w]);
+            }
+            binStart[du]++;
+            degrees[u]--;
+        };
+
+        // ::::: Peel vertices in non-decreasing degree order
+        std::vector<int> coreNumbers(n);
+        for (int i = 0; i < n; ++i) {
+            int v = vert[i];
+            coreNumbers[v] = degrees[v];
+
+            // ::::: Removing v lowers in-degrees of its out-neighbors
+            for (const auto& [u, _] : graph.getNeighbors(v)) {
+                if (degrees[u] > degrees[v]) {
+                    inDegrees[u]--;
+                    if (std::min(inDegrees[u], outDegrees[u]) < degrees[u]) {
+                        lowerDegree(u);
                     }
+                }
+            }
 
-                    // ::::: Update in-neighbors
-                    for (int u : inNeighbors[v]) {
-                        if (outDegrees[u] > minDegree) {
-                            outDegrees[u]--;
-                        }
+            // ::::: ... and out-degrees of its in-neighbors
+            for (int e = inOffsets[v]; e < inOffsets[v + 1]; ++e) {
+                int u = inNeighbors[e];
+                if (degrees[u] > degrees[v]) {
+                    outDegrees[u]--;
+                    if (std::min(inDegrees[u], outDegrees[u]) < degrees[u]) {
+                        lowerDegree(u);
                     }
                 }
             }
         }
 
+        Instrumentation::addCount("kcore.degree_decrements", degreeDecrements);
+        Instrumentation::addCount("kcore.edge_traversals", 2ull * totalEdges);
+
         return Result(coreNumbers);
     }
 
+    // ::::: Repair core numbers after a small edge delta instead of re-peeling
+    // ::::: the whole graph. Removals can only lower cores, so starting from
+    // ::::: the previous values and iterating the local core condition
+    // ::::: downward converges to the exact result. Insertions can raise a
+    // ::::: core by at most one per edge, and only inside the region of
+    // ::::: vertices with the same core number reachable from the endpoints;
+    // ::::: those regions are lifted by one and the same downward iteration
+    // ::::: settles them. Rounds repeat until no region lifts again, which
+    // ::::: handles chained rises from batched insertions. graph must already
+    // ::::: reflect the delta.
+    template <typename GraphT>
+    static Result update(const GraphT& graph, const Result& previous,
+                         const std::vector<std::pair<int, int>>& insertedEdges,
+                         const std::vector<std::pair<int, int>>& removedEdges) {
+        int n = graph.getNumVertices();
+        if (n == 0) throw std::invalid_argument("Graph is empty");
+
+        // ::::: Flat in-neighbor arrays, as in decompose
+        std::vector<int> inOffsets(n + 1, 0);
+        size_t totalEdges = 0;
+        for (int u = 0; u < n; ++u) {
+            for (const auto& [v, _] : graph.getNeighbors(u)) {
+                inOffsets[v + 1]++;
+                totalEdges++;
+            }
+        }
+        for (int v = 0; v < n; ++v) {
+            inOffsets[v + 1] += inOffsets[v];
+        }
+        std::vector<int> inNeighbors(totalEdges);
+        {
+            std::vector<int> cursor(inOffsets.begin(), inOffsets.end() - 1);
+            for (int u = 0; u < n; ++u) {
+                for (const auto& [v, _] : graph.getNeighbors(u)) {
+                    inNeighbors[cursor[v]++] = u;
+                }
+            }
+        }
+
+        std::vector<int> degrees(n);
+        int maxDegree = 0;
+        for (int v = 0; v < n; ++v) {
+            int inDegree = inOffsets[v + 1] - inOffsets[v];
+            int outDegree = static_cast<int>(graph.getNeighbors(v).size());
+            degrees[v] = std::min(inDegree, outDegree);
+            maxDegree = std::max(maxDegree, degrees[v]);
+        }
+
+        // ::::: Working values: previous cores capped by the new degrees;
+        // ::::: vertices unseen before start from their degree bound
+        int previousCount = static_cast<int>(previous.coreNumbers.size());
+        std::vector<int> values(n);
+        for (int v = 0; v < n; ++v) {
+            values[v] = v < previousCount ? std::min(previous.coreNumbers[v], degrees[v])
+                                          : degrees[v];
+        }
+
+        std::queue<int> pending;
+        std::vector<char> queued(n, 0);
+        auto enqueue = [&](int v) {
+            if (!queued[v]) {
+                queued[v] = 1;
+                pending.push(v);
+            }
+        };
+        auto enqueueNeighborhood = [&](int v) {
+            enqueue(v);
+            for (const auto& [u, _] : graph.getNeighbors(v)) enqueue(u);
+            for (int e = inOffsets[v]; e < inOffsets[v + 1]; ++e) enqueue(inNeighbors[e]);
+        };
+
+        // ::::: Anything whose working value moved can invalidate neighbors
+        for (int v = 0; v < n; ++v) {
+            if (v >= previousCount || values[v] != previous.coreNumbers[v]) {
+                enqueueNeighborhood(v);
+            }
+        }
+        for (const auto& [u, v] : removedEdges) {
+            if (u < n) enqueueNeighborhood(u);
+            if (v < n) enqueueNeighborhood(v);
+        }
+
+        // ::::: Largest k <= values[v] with k in-neighbors and k out-neighbors
+        // ::::: currently valued at least k
+        std::vector<int> inCount(maxDegree + 2, 0), outCount(maxDegree + 2, 0);
+        auto coreCondition = [&](int v) {
+            int cap = values[v];
+            if (cap == 0) return 0;
+            std::fill(inCount.begin(), inCount.begin() + cap + 1, 0);
+            std::fill(outCount.begin(), outCount.begin() + cap + 1, 0);
+            for (const auto& [u, _] : graph.getNeighbors(v)) {
+                outCount[std::min(values[u], cap)]++;
+            }
+            for (int e = inOffsets[v]; e < inOffsets[v + 1]; ++e) {
+                inCount[std::min(values[inNeighbors[e]], cap)]++;
+            }
+            int cumIn = 0, cumOut = 0;
+            for (int k = cap; k >= 1; --k) {
+                cumIn += inCount[k];
+                cumOut += outCount[k];
+                if (cumIn >= k && cumOut >= k) return k;
+            }
+            return 0;
+        };
+
+        auto settle = [&]() {
+            while (!pending.empty()) {
+                int v = pending.front();
+                pending.pop();
+                queued[v] = 0;
+                int supported = coreCondition(v);
+                if (supported < values[v]) {
+                    values[v] = supported;
+                    enqueueNeighborhood(v);
+                }
+            }
+        };
+
+        std::vector<char> visited(n, 0);
+        std::vector<int> lastLiftLevel(insertedEdges.size(), -1);
+        bool lifted = true;
+        while (lifted) {
+            settle();
+            lifted = false;
+
+            // ::::: Lift the candidate region of each inserted edge: vertices
+            // ::::: sharing the endpoints' smaller core value and reachable
+            // ::::: through vertices of that value (either edge direction).
+            // ::::: A level already tried for an edge is not retried, so a
+            // ::::: lift that settles straight back down cannot loop.
+            for (size_t i = 0; i < insertedEdges.size(); ++i) {
+                const auto& [src, dst] = insertedEdges[i];
+                if (src >= n || dst >= n) {
+                    throw std::invalid_argument("Inserted edge references an unknown vertex");
+                }
+                int level = std::min(values[src], values[dst]);
+                if (level == lastLiftLevel[i]) continue;
+                lastLiftLevel[i] = level;
+                std::vector<int> region;
+                std::queue<int> frontier;
+                auto visit = [&](int v) {
+                    if (!visited[v] && values[v] == level) {
+                        visited[v] = 1;
+                        frontier.push(v);
+                        region.push_back(v);
+                    }
+                };
+                visit(src);
+                visit(dst);
+                while (!frontier.empty()) {
+                    int v = frontier.front();
+                    frontier.pop();
+                    for (const auto& [u, _] : graph.getNeighbors(v)) visit(u);
+                    for (int e = inOffsets[v]; e < inOffsets[v + 1]; ++e) visit(inNeighbors[e]);
+                }
+                for (int v : region) {
+                    visited[v] = 0;
+                    if (degrees[v] > level) {
+                        values[v] = level + 1;
+                        enqueueNeighborhood(v);
+                        lifted = true;
+                    }
+                }
+            }
+        }
+
+        return Result(values);
+    }
+
     static std::vector<std::vector<int>> getKCoreSubgraphs(const Graph& graph, const Result& result, int minK = 0) {
         if (minK < 0) throw std::invalid_argument("Minimum k must be non-negative");
 
@@ -115,7 +341,8 @@ public:
         return hierarchy;
     }
 
-    static bool isKCore(const Graph& graph, const std::vector<int>& vertices, int k) {
+    template <typename GraphT>
+    static bool isKCore(const GraphT& graph, const std::vector<int>& vertices, int k) {
         if (k < 0) throw std::invalid_argument("k must be non-negative");
         
         std::unordered_set<int> vertexSet(vertices.begin(), vertices.end());
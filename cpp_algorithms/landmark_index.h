@@ -0,0 +1,318 @@
+#ifndef LANDMARK_INDEX_H
+#define LANDMARK_INDEX_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+// ::::: Landmark distance sketch for degrees-of-separation queries.
+// ::::: The API's hottest query is "how many hops between user A and B",
+// ::::: previously answered by a full BFS per request. The index stores BFS
+// ::::: distances from a few dozen high-degree landmark vertices; at query
+// ::::: time the triangle inequality over the landmarks gives tight
+// ::::: lower/upper bounds in O(landmarks) array lookups, and a bounded
+// ::::: search is run only when the caller needs the exact hop count and the
+// ::::: bounds do not already agree. Vertex ids must be dense 0..n-1 (use
+// ::::: GraphBuilder::relabelGraph for sparse id spaces).
+class LandmarkIndex {
+private:
+    int numVertices = 0;
+    bool directed = false;
+    std::vector<int> landmarks;
+    // ::::: distFrom[l * numVertices + v] = hops landmark l -> v (-1 unreachable)
+    std::vector<int32_t> distFrom;
+    // ::::: distTo[l * numVertices + v] = hops v -> landmark l; only stored
+    // ::::: for directed graphs (equal to distFrom on undirected ones)
+    std::vector<int32_t> distTo;
+
+    LandmarkIndex() = default;
+
+    int32_t fromLandmark(size_t l, int v) const { return distFrom[l * numVertices + v]; }
+    int32_t toLandmark(size_t l, int v) const {
+        return directed ? distTo[l * numVertices + v] : distFrom[l * numVertices + v];
+    }
+
+    template <typename AdjacencyT>
+    static void bfsInto(const AdjacencyT& neighborsOf, int source, int n, int32_t* distances) {
+        std::fill(distances, distances + n, -1);
+        distances[source] = 0;
+        std::queue<int> frontier;
+        frontier.push(source);
+        while (!frontier.empty()) {
+            int current = frontier.front();
+            frontier.pop();
+            for (int neighbor : neighborsOf(current)) {
+                if (distances[neighbor] == -1) {
+                    distances[neighbor] = distances[current] + 1;
+                    frontier.push(neighbor);
+                }
+            }
+        }
+    }
+
+public:
+    // ::::: Distance bounds from the sketch alone. lower == upper means the
+    // ::::: sketch already answered exactly (always true when either endpoint
+    // ::::: is a landmark).
+    struct Bounds {
+        int lowerBound;
+        int upperBound; // ::::: INT_MAX when no landmark connects the pair
+
+        bool isExact() const { return lowerBound == upperBound; }
+    };
+
+    // ::::: Build the index: BFS from the numLandmarks highest-degree
+    // ::::: vertices (hubs sit on most short paths in social graphs). On
+    // ::::: directed graphs a second, reverse BFS per landmark records the
+    // ::::: vertex-to-landmark distances the triangle inequality needs.
+    template <typename GraphT>
+    static LandmarkIndex build(const GraphT& graph, int numLandmarks = 32) {
+        int n = graph.getNumVertices();
+        if (n == 0) throw std::invalid_argument("Graph is empty");
+        numLandmarks = std::min(numLandmarks, n);
+        if (numLandmarks <= 0) throw std::invalid_argument("Need at least one landmark");
+
+        LandmarkIndex index;
+        index.numVertices = n;
+        index.directed = graph.isDirectedGraph();
+
+        // ::::: Highest-degree vertices first
+        std::vector<int> byDegree(n);
+        for (int v = 0; v < n; ++v) byDegree[v] = v;
+        std::stable_sort(byDegree.begin(), byDegree.end(),
+                         [&graph](int a, int b) {
+                             return graph.getNeighbors(a).size() > graph.getNeighbors(b).size();
+                         });
+        index.landmarks.assign(byDegree.begin(), byDegree.begin() + numLandmarks);
+
+        auto forward = [&graph](int v) {
+            std::vector<int> targets;
+            for (const auto& neighbor : graph.getNeighbors(v)) {
+                targets.push_back(neighbor.first);
+            }
+            return targets;
+        };
+
+        index.distFrom.resize(static_cast<size_t>(numLandmarks) * n);
+        for (size_t l = 0; l < index.landmarks.size(); ++l) {
+            bfsInto(forward, index.landmarks[l], n, index.distFrom.data() + l * n);
+        }
+
+        if (index.directed) {
+            // ::::: One reverse adjacency build shared by every reverse BFS
+            std::vector<std::vector<int>> reverseAdj(n);
+            for (int v = 0; v < n; ++v) {
+                for (const auto& neighbor : graph.getNeighbors(v)) {
+                    reverseAdj[neighbor.first].push_back(v);
+                }
+            }
+            auto backward = [&reverseAdj](int v) -> const std::vector<int>& {
+                return reverseAdj[v];
+            };
+            index.distTo.resize(static_cast<size_t>(numLandmarks) * n);
+            for (size_t l = 0; l < index.landmarks.size(); ++l) {
+                bfsInto(backward, index.landmarks[l], n, index.distTo.data() + l * n);
+            }
+        }
+
+        return index;
+    }
+
+    // ::::: Sketch-only query: O(landmarks) lookups, no graph access.
+    // ::::: Upper bound: min over landmarks of d(a,L) + d(L,b).
+    // ::::: Lower bound: the triangle inequality rearranged, e.g.
+    // ::::: d(a,b) >= d(L,b) - d(L,a).
+    Bounds estimateDistance(int a, int b) const {
+        if (a < 0 || a >= numVertices || b < 0 || b >= numVertices) {
+            throw std::invalid_argument("Vertex not in index");
+        }
+        if (a == b) return {0, 0};
+
+        int upper = std::numeric_limits<int>::max();
+        int lower = 1; // ::::: Distinct vertices are at least one hop apart
+        for (size_t l = 0; l < landmarks.size(); ++l) {
+            int32_t aToL = toLandmark(l, a);
+            int32_t lToB = fromLandmark(l, b);
+            if (aToL >= 0 && lToB >= 0) {
+                upper = std::min(upper, aToL + lToB);
+            }
+
+            int32_t lToA = fromLandmark(l, a);
+            if (lToA >= 0 && lToB >= 0) {
+                lower = std::max(lower, lToB - lToA);
+            }
+            int32_t bToL = toLandmark(l, b);
+            if (aToL >= 0 && bToL >= 0) {
+                lower = std::max(lower, aToL - bToL);
+            }
+        }
+
+        if (upper < std::numeric_limits<int>::max()) {
+            lower = std::min(lower, upper);
+        }
+        return {lower, upper};
+    }
+
+    // ::::: Exact hop count, using the sketch first and searching only when
+    // ::::: the bounds disagree. Undirected graphs get a bidirectional BFS
+    // ::::: (always expanding the smaller frontier); directed graphs fall
+    // ::::: back to a forward BFS cut off at the sketch's upper bound.
+    // ::::: Returns -1 when no path exists.
+    template <typename GraphT>
+    int exactDistance(const GraphT& graph, int a, int b) const {
+        Bounds bounds = estimateDistance(a, b);
+        if (bounds.upperBound == std::numeric_limits<int>::max()) {
+            // ::::: Landmarks reach every vertex of their component, so no
+            // ::::: connecting landmark on an undirected graph means no path
+            if (!directed) return -1;
+        } else if (bounds.isExact()) {
+            return bounds.upperBound;
+        }
+        int depthLimit = bounds.upperBound;
+
+        if (!directed) {
+            // ::::: Bidirectional BFS bounded by the sketch's upper bound;
+            // ::::: meet-in-the-middle explores O(sqrt) of what a one-sided
+            // ::::: BFS would. Each level completes before a meeting is
+            // ::::: accepted, so the best meeting sum is the exact distance.
+            std::unordered_map<int, int> distA{{a, 0}}, distB{{b, 0}};
+            std::vector<int> frontierA{a}, frontierB{b};
+            int levelA = 0, levelB = 0;
+            int best = depthLimit;
+
+            while (!frontierA.empty() && !frontierB.empty() &&
+                   levelA + levelB + 1 < best) {
+                bool expandA = frontierA.size() <= frontierB.size();
+                auto& frontier = expandA ? frontierA : frontierB;
+                auto& seen = expandA ? distA : distB;
+                auto& other = expandA ? distB : distA;
+                int level = (expandA ? levelA : levelB) + 1;
+
+                std::vector<int> next;
+                for (int current : frontier) {
+                    for (const auto& neighbor : graph.getNeighbors(current)) {
+                        if (seen.count(neighbor.first)) continue;
+                        auto meet = other.find(neighbor.first);
+                        if (meet != other.end()) {
+                            best = std::min(best, level + meet->second);
+                        }
+                        seen[neighbor.first] = level;
+                        next.push_back(neighbor.first);
+                    }
+                }
+                frontier = std::move(next);
+                (expandA ? levelA : levelB) = level;
+            }
+            return best;
+        }
+
+        // ::::: Directed fallback: forward BFS from a, bounded by the sketch
+        std::unordered_map<int, int> distances{{a, 0}};
+        std::vector<int> frontier{a};
+        int level = 0;
+        while (!frontier.empty() && level < depthLimit) {
+            ++level;
+            std::vector<int> next;
+            for (int current : frontier) {
+                for (const auto& neighbor : graph.getNeighbors(current)) {
+                    if (distances.count(neighbor.first)) continue;
+                    if (neighbor.first == b) return level;
+                    distances[neighbor.first] = level;
+                    next.push_back(neighbor.first);
+                }
+            }
+            frontier = std::move(next);
+        }
+        return depthLimit == std::numeric_limits<int>::max() ? -1 : depthLimit;
+    }
+
+    int getNumVertices() const { return numVertices; }
+    int getNumLandmarks() const { return static_cast<int>(landmarks.size()); }
+    const std::vector<int>& getLandmarks() const { return landmarks; }
+    bool isDirectedGraph() const { return directed; }
+
+    // ::::: On-disk format mirrors the binary graph file: fixed header, then
+    // ::::: the landmark ids, then the flat distance arrays.
+    struct FileHeader {
+        static constexpr uint32_t MAGIC = 0x494C5847; // ::::: "GXLI"
+        static constexpr uint32_t VERSION = 1;
+
+        uint32_t magic;
+        uint32_t version;
+        uint32_t directed;
+        int32_t numVertices;
+        uint32_t numLandmarks;
+    };
+
+    void save(const std::string& filename) const {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open output file: " + filename);
+        }
+
+        FileHeader header;
+        header.magic = FileHeader::MAGIC;
+        header.version = FileHeader::VERSION;
+        header.directed = directed ? 1 : 0;
+        header.numVertices = numVertices;
+        header.numLandmarks = static_cast<uint32_t>(landmarks.size());
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(landmarks.data()),
+                   landmarks.size() * sizeof(int));
+        file.write(reinterpret_cast<const char*>(distFrom.data()),
+                   distFrom.size() * sizeof(int32_t));
+        file.write(reinterpret_cast<const char*>(distTo.data()),
+                   distTo.size() * sizeof(int32_t));
+
+        if (!file) {
+            throw std::runtime_error("Failed writing landmark index: " + filename);
+        }
+    }
+
+    static LandmarkIndex load(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open landmark index: " + filename);
+        }
+
+        FileHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || header.magic != FileHeader::MAGIC) {
+            throw std::runtime_error("Not a landmark index file (bad magic)");
+        }
+        if (header.version != FileHeader::VERSION) {
+            throw std::runtime_error("Unsupported landmark index version");
+        }
+
+        LandmarkIndex index;
+        index.numVertices = header.numVertices;
+        index.directed = header.directed != 0;
+        index.landmarks.resize(header.numLandmarks);
+        index.distFrom.resize(static_cast<size_t>(header.numLandmarks) * header.numVertices);
+        if (index.directed) {
+            index.distTo.resize(index.distFrom.size());
+        }
+
+        file.read(reinterpret_cast<char*>(index.landmarks.data()),
+                  index.landmarks.size() * sizeof(int));
+        file.read(reinterpret_cast<char*>(index.distFrom.data()),
+                  index.distFrom.size() * sizeof(int32_t));
+        file.read(reinterpret_cast<char*>(index.distTo.data()),
+                  index.distTo.size() * sizeof(int32_t));
+        if (!file) {
+            throw std::runtime_error("Landmark index file is truncated: " + filename);
+        }
+
+        return index;
+    }
+};
+
+#endif
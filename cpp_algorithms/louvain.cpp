@@ -1,106 +1,288 @@
 #include "graph.h"
+#include "arena_allocator.h"
+#include "instrumentation.h"
 #include <vector>
+#include <cstdint>
 #include <unordered_map>
 #include <cmath>
 #include <algorithm>
 #include <stdexcept>
 #include <sstream>
 #include <iomanip>
+#include <chrono>
 
 class Louvain {
 private:
-    struct Community {
-        std::vector<size_t> nodes;
-        double totalWeight;
-        std::unordered_map<size_t, double> connections;
-        
-        Community() : totalWeight(0.0) {}
-        
-        void addNode(size_t node, const Graph& graph) {
-            nodes.push_back(node);
+    // ::::: All per-run bookkeeping (level adjacency, merge maps, move
+    // ::::: scratch) comes from arenas scoped to one detection run, so the
+    // ::::: thousands of small node vectors and map entries never touch the
+    // ::::: global allocator and are released in one shot at the end
+    using ArenaNeighborVector =
+        std::vector<std::pair<int, double>, ArenaAllocator<std::pair<int, double>>>;
+    using ArenaWeightMap =
+        std::unordered_map<size_t, double, std::hash<size_t>, std::equal_to<size_t>,
+                           ArenaAllocator<std::pair<const size_t, double>>>;
+
+    // ::::: Weighted degree of every node plus the total graph weight.
+    // ::::: Assumes the dense vertex ids the rest of the engine uses.
+    template <typename GraphT>
+    static std::vector<double> calculateNodeWeights(const GraphT& graph, double& totalWeight) {
+        size_t n = static_cast<size_t>(graph.getNumVertices());
+        std::vector<double> nodeWeights(n, 0.0);
+        totalWeight = 0.0;
+
+        for (size_t node = 0; node < n; ++node) {
             for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
-                connections[static_cast<size_t>(neighbor.first)] += neighbor.second;
+                nodeWeights[node] += neighbor.second;
                 totalWeight += neighbor.second;
             }
         }
-        
-        void removeNode(size_t node, const Graph& graph) {
-            nodes.erase(std::remove(nodes.begin(), nodes.end(), node), nodes.end());
-            for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
-                connections[static_cast<size_t>(neighbor.first)] -= neighbor.second;
-                if (connections[static_cast<size_t>(neighbor.first)] <= 0.0) {
-                    connections.erase(static_cast<size_t>(neighbor.first));
-                }
-                totalWeight -= neighbor.second;
-            }
-        }
-        
-        bool hasNode(size_t node) const {
-            return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
-        }
-        
-        size_t size() const { return nodes.size(); }
-    };
 
+        totalWeight /= 2.0;  // ::::: Each edge contributes to two endpoints
+        return nodeWeights;
+    }
+
+    // ::::: Modularity of a full assignment from per-community weight sums,
+    // ::::: computed in a single O(E) pass over the graph
+    template <typename GraphT>
     static double calculateModularity(
-        const std::vector<Community>& communities,
-        const Graph& graph,
+        const GraphT& graph,
+        const std::vector<size_t>& communities,
         double totalWeight) {
         if (totalWeight <= 0.0) {
             throw std::invalid_argument("Total weight must be positive");
         }
-        
-        double modularity = 0.0;
-        
-        for (const auto& community : communities) {
-            for (const size_t node : community.nodes) {
-                for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
-                    if (community.hasNode(static_cast<size_t>(neighbor.first))) {
-                        modularity += neighbor.second - 
-                            (community.totalWeight * community.totalWeight) / 
-                            (2.0 * totalWeight);
-                    }
+
+        size_t numCommunities = communities.empty() ? 0 :
+            *std::max_element(communities.begin(), communities.end()) + 1;
+        std::vector<double> internalWeights(numCommunities, 0.0);
+        std::vector<double> communityWeights(numCommunities, 0.0);
+
+        for (size_t node = 0; node < communities.size(); ++node) {
+            for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
+                communityWeights[communities[node]] += neighbor.second;
+                if (communities[static_cast<size_t>(neighbor.first)] == communities[node]) {
+                    internalWeights[communities[node]] += neighbor.second;
                 }
             }
         }
-        
-        return modularity / (2.0 * totalWeight);
+
+        double modularity = 0.0;
+        for (size_t c = 0; c < numCommunities; ++c) {
+            double fraction = communityWeights[c] / (2.0 * totalWeight);
+            modularity += internalWeights[c] / (2.0 * totalWeight) - fraction * fraction;
+        }
+
+        return modularity;
     }
 
-    static double calculateDeltaModularity(
-        size_t node,
-        size_t community,
-        const std::vector<Community>& communities,
-        const Graph& graph,
-        double totalWeight) {
-        if (totalWeight <= 0.0) {
-            throw std::invalid_argument("Total weight must be positive");
+    // ::::: Renumber community ids densely so downstream consumers never see
+    // ::::: gaps left behind by emptied communities
+    static size_t renumberCommunities(std::vector<size_t>& communities) {
+        std::unordered_map<size_t, size_t> relabel;
+        for (size_t& community : communities) {
+            auto it = relabel.find(community);
+            if (it == relabel.end()) {
+                it = relabel.insert({community, relabel.size()}).first;
+            }
+            community = it->second;
         }
-        if (community >= communities.size()) {
-            throw std::out_of_range("Invalid community index");
+        return relabel.size();
+    }
+
+    // ::::: Minimal weighted adjacency for the induced community graphs built
+    // ::::: between coarsening levels (self-loops carry internal weight)
+    struct LevelGraph {
+        std::vector<ArenaNeighborVector> adjacency;
+
+        int getNumVertices() const { return static_cast<int>(adjacency.size()); }
+        const ArenaNeighborVector& getNeighbors(int vertex) const {
+            return adjacency[static_cast<size_t>(vertex)];
         }
-        
-        double ki = 0.0;
-        double ki_in = 0.0;
-        
-        for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
-            ki += neighbor.second;
-            if (communities[community].hasNode(static_cast<size_t>(neighbor.first))) {
-                ki_in += neighbor.second;
+    };
+
+    // ::::: Collapse each community into a single vertex, accumulating edge
+    // ::::: weights between communities and internal weight as self-loops
+    template <typename GraphT>
+    static LevelGraph buildInducedGraph(
+        const GraphT& graph,
+        const std::vector<size_t>& communities,
+        size_t numCommunities,
+        MemoryArena& arena,
+        MemoryArena& scratch) {
+        scratch.reset();
+        std::vector<ArenaWeightMap> merged(
+            numCommunities,
+            ArenaWeightMap(ArenaAllocator<std::pair<const size_t, double>>(scratch)));
+
+        for (size_t node = 0; node < communities.size(); ++node) {
+            for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
+                merged[communities[node]][communities[static_cast<size_t>(neighbor.first)]] += neighbor.second;
             }
         }
-        
-        return ki_in - (ki * communities[community].totalWeight) / totalWeight;
+
+        LevelGraph induced;
+        induced.adjacency.assign(
+            numCommunities,
+            ArenaNeighborVector(ArenaAllocator<std::pair<int, double>>(arena)));
+        for (size_t c = 0; c < numCommunities; ++c) {
+            for (const auto& [target, weight] : merged[c]) {
+                induced.adjacency[c].push_back({static_cast<int>(target), weight});
+            }
+        }
+
+        return induced;
+    }
+
+    // ::::: Modularity is an undirected quantity; merge both edge directions
+    // ::::: so directed inputs do not make nodes chase their out-neighbors
+    template <typename GraphT>
+    static LevelGraph symmetrize(const GraphT& graph, MemoryArena& arena, MemoryArena& scratch) {
+        scratch.reset();
+        size_t n = static_cast<size_t>(graph.getNumVertices());
+        using MergeMap = std::unordered_map<int, double, std::hash<int>, std::equal_to<int>,
+                                            ArenaAllocator<std::pair<const int, double>>>;
+        std::vector<MergeMap> merged(
+            n, MergeMap(ArenaAllocator<std::pair<const int, double>>(scratch)));
+
+        for (size_t node = 0; node < n; ++node) {
+            for (const auto& [target, weight] : graph.getNeighbors(static_cast<int>(node))) {
+                merged[node][target] += weight;
+                merged[static_cast<size_t>(target)][static_cast<int>(node)] += weight;
+            }
+        }
+
+        LevelGraph symmetric;
+        symmetric.adjacency.assign(
+            n, ArenaNeighborVector(ArenaAllocator<std::pair<int, double>>(arena)));
+        for (size_t node = 0; node < n; ++node) {
+            for (const auto& [target, weight] : merged[node]) {
+                symmetric.adjacency[node].push_back({target, weight});
+            }
+        }
+
+        return symmetric;
+    }
+
+    // ::::: One level of local moves: sweep nodes into the adjacent community
+    // ::::: with the best modularity gain until no move improves or the
+    // ::::: iteration budget runs out. Returns whether any node moved at all.
+    template <typename GraphT>
+    static bool localMove(
+        const GraphT& graph,
+        std::vector<size_t>& communities,
+        double totalWeight,
+        size_t maxIterations,
+        size_t& iterations,
+        bool& converged,
+        MemoryArena& scratch) {
+        size_t n = static_cast<size_t>(graph.getNumVertices());
+        double levelWeight = 0.0;
+        std::vector<double> nodeWeights = calculateNodeWeights(graph, levelWeight);
+        (void)levelWeight;  // ::::: Total weight is invariant across levels
+
+        // ::::: Each node starts in its own community; communityWeights holds
+        // ::::: the incrementally maintained total weight per community
+        communities.resize(n);
+        std::vector<double> communityWeights(nodeWeights);
+        for (size_t i = 0; i < n; ++i) {
+            communities[i] = i;
+        }
+
+        bool improved;
+        bool anyMove = false;
+        uint64_t movesMade = 0;
+        iterations = 0;
+        double previousModularity = calculateModularity(graph, communities, totalWeight);
+
+        do {
+            improved = false;
+
+            // ::::: Try to move each node to a different community
+            for (size_t node = 0; node < n; ++node) {
+                size_t currentCommunity = communities[node];
+
+                // ::::: Edge weight from node into each adjacent community,
+                // ::::: accumulated in O(degree). Rewinding the scratch arena
+                // ::::: per node makes the fresh map a few pointer bumps.
+                scratch.reset();
+                ArenaAllocator<std::pair<const size_t, double>> scratchAlloc(scratch);
+                ArenaWeightMap neighborCommunityWeights(scratchAlloc);
+                neighborCommunityWeights[currentCommunity] = 0.0;
+                for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
+                    size_t neighborNode = static_cast<size_t>(neighbor.first);
+                    if (neighborNode != node) {
+                        neighborCommunityWeights[communities[neighborNode]] += neighbor.second;
+                    }
+                }
+
+                // ::::: Take the node out of its community while evaluating moves
+                communityWeights[currentCommunity] -= nodeWeights[node];
+
+                // ::::: Gain of joining a community relative to staying isolated:
+                // ::::: ki_in - sigma_tot * ki / (2m), evaluated per adjacent community
+                double bestGain = neighborCommunityWeights[currentCommunity] -
+                    (communityWeights[currentCommunity] * nodeWeights[node]) / (2.0 * totalWeight);
+                size_t bestCommunity = currentCommunity;
+
+                for (const auto& [community, weightToCommunity] : neighborCommunityWeights) {
+                    if (community == currentCommunity) {
+                        continue;
+                    }
+                    double gain = weightToCommunity -
+                        (communityWeights[community] * nodeWeights[node]) / (2.0 * totalWeight);
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        bestCommunity = community;
+                    }
+                }
+
+                // ::::: Re-insert the node into the best community found
+                communityWeights[bestCommunity] += nodeWeights[node];
+                if (bestCommunity != currentCommunity) {
+                    communities[node] = bestCommunity;
+                    improved = true;
+                    anyMove = true;
+                    ++movesMade;
+                }
+            }
+
+            iterations++;
+
+            // ::::: Locally positive gains can ping-pong on asymmetric
+            // ::::: (directed) adjacency; stop the sweep loop as soon as a
+            // ::::: sweep fails to raise modularity
+            if (improved) {
+                double modularity = calculateModularity(graph, communities, totalWeight);
+                if (modularity <= previousModularity + 1e-9) {
+                    improved = false;
+                }
+                previousModularity = modularity;
+            }
+        } while (improved && iterations < maxIterations);
+
+        converged = !improved;
+        Instrumentation::addCount("louvain.moves", movesMade);
+        return anyMove;
     }
 
 public:
+    // ::::: Statistics for one coarsening level
+    struct LevelInfo {
+        size_t numCommunities;
+        double modularity;
+        size_t iterations;
+        double seconds;
+    };
+
     struct Result {
         std::vector<size_t> communities;
         size_t numCommunities;
         double modularity;
         size_t iterations;
         bool converged;
-        
+        std::vector<LevelInfo> levels;
+
         Result(const std::vector<size_t>& comms, double mod, size_t iters, bool conv) 
             : communities(comms), modularity(mod), iterations(iters), converged(conv) {
             numCommunities = comms.empty() ? 0 :
@@ -115,8 +297,17 @@ public:
             oss << "Number of communities: " << numCommunities << "\n";
             oss << "Modularity: " << modularity << "\n";
             oss << "Iterations: " << iterations;
-            oss << (converged ? " (converged)" : " (max iterations reached)") << "\n\n";
-            
+            oss << (converged ? " (converged)" : " (max iterations reached)") << "\n";
+
+            // ::::: Per-level breakdown from the coarsening phase
+            for (size_t level = 0; level < levels.size(); ++level) {
+                oss << "Level " << level << ": " << levels[level].numCommunities
+                    << " communities, modularity " << levels[level].modularity
+                    << ", " << levels[level].iterations << " iterations, "
+                    << levels[level].seconds << "s\n";
+            }
+            oss << "\n";
+
             // ::::: Get community sizes
             std::vector<size_t> sizes(numCommunities, 0);
             for (size_t comm : communities) {
@@ -132,8 +323,9 @@ public:
         }
     };
 
+    template <typename GraphT>
     static Result detectCommunities(
-        const Graph& graph,
+        const GraphT& graph,
         size_t maxIterations = 100) {
         if (maxIterations == 0) {
             throw std::invalid_argument("Maximum iterations must be positive");
@@ -143,78 +335,72 @@ public:
         if (n == 0) {
             throw std::invalid_argument("Graph is empty");
         }
-        
-        std::vector<size_t> communities(n);
-        std::vector<Community> communityStructs;
-        
-        // ::::: Initialize each node as its own community
-        for (size_t i = 0; i < n; ++i) {
-            communities[i] = i;
-            Community c;
-            c.addNode(i, graph);
-            communityStructs.push_back(c);
-        }
-        
-        // ::::: Calculate total weight
+
+        // ::::: All levels run on the symmetrized graph; total weight is
+        // ::::: computed once and invariant across coarsening levels.
+        // ::::: levelArena holds the level graphs for the whole run; scratch
+        // ::::: is rewound continuously for transient maps.
+        MemoryArena levelArena;
+        MemoryArena scratch;
+        LevelGraph base = symmetrize(graph, levelArena, scratch);
         double totalWeight = 0.0;
-        for (const auto& community : communityStructs) {
-            totalWeight += community.totalWeight;
-        }
-        totalWeight /= 2.0;  // ::::: Each edge is counted twice
-        
+        calculateNodeWeights(base, totalWeight);
+
         if (totalWeight <= 0.0) {
             throw std::runtime_error("Graph has no edges");
         }
-        
-        bool improved;
-        size_t iteration = 0;
-        double currentModularity = calculateModularity(communityStructs, graph, totalWeight);
-        
-        do {
-            improved = false;
-            
-            // ::::: Try to move each node to a different community
-            for (size_t node = 0; node < n; ++node) {
-                size_t currentCommunity = communities[node];
-                double bestDeltaModularity = 0.0;
-                size_t bestCommunity = currentCommunity;
-                
-                // ::::: Try moving to each neighboring community
-                for (const auto& neighbor : graph.getNeighbors(static_cast<int>(node))) {
-                    size_t neighborCommunity = communities[static_cast<size_t>(neighbor.first)];
-                    if (neighborCommunity != currentCommunity) {
-                        double deltaModularity = calculateDeltaModularity(
-                            node, neighborCommunity, communityStructs, graph, totalWeight);
-                        
-                        if (deltaModularity > bestDeltaModularity) {
-                            bestDeltaModularity = deltaModularity;
-                            bestCommunity = neighborCommunity;
-                        }
-                    }
-                }
-                
-                // ::::: Move node if improvement found
-                if (bestCommunity != currentCommunity) {
-                    // ::::: Remove from current community
-                    communityStructs[currentCommunity].removeNode(node, graph);
-                    
-                    // ::::: Add to new community
-                    communityStructs[bestCommunity].addNode(node, graph);
-                    communities[node] = bestCommunity;
-                    
-                    improved = true;
-                }
+
+        // ::::: Flattened assignment of every original node, refined per level
+        std::vector<size_t> assignment(n);
+        for (size_t i = 0; i < n; ++i) {
+            assignment[i] = i;
+        }
+
+        std::vector<LevelInfo> levels;
+        LevelGraph coarse = base;
+        size_t totalIterations = 0;
+        size_t levelVertices = n;
+        bool converged = false;
+
+        // ::::: Multi-level loop: local moves, then collapse communities into
+        // ::::: an induced graph and repeat until no level improves further
+        while (true) {
+            auto levelStart = std::chrono::steady_clock::now();
+
+            std::vector<size_t> levelCommunities;
+            size_t levelIterations = 0;
+            bool moved = localMove(coarse, levelCommunities, totalWeight, maxIterations,
+                                   levelIterations, converged, scratch);
+            totalIterations += levelIterations;
+
+            size_t numCommunities = renumberCommunities(levelCommunities);
+
+            // ::::: Project the level assignment back onto the original nodes
+            for (size_t i = 0; i < n; ++i) {
+                assignment[i] = levelCommunities[assignment[i]];
             }
-            
-            iteration++;
-            
-            // ::::: Update modularity
-            if (improved) {
-                currentModularity = calculateModularity(communityStructs, graph, totalWeight);
+
+            auto levelEnd = std::chrono::steady_clock::now();
+            levels.push_back({numCommunities,
+                              calculateModularity(base, assignment, totalWeight),
+                              levelIterations,
+                              std::chrono::duration<double>(levelEnd - levelStart).count()});
+            Instrumentation::addSample("louvain.level_modularity", levels.back().modularity);
+            Instrumentation::addSample("louvain.level_seconds", levels.back().seconds);
+
+            // ::::: Stop when the level made no move or could not coarsen
+            if (!moved || numCommunities == levelVertices) {
+                break;
             }
-        } while (improved && iteration < maxIterations);
-        
-        return Result(communities, currentModularity, iteration, !improved);
+
+            coarse = buildInducedGraph(coarse, levelCommunities, numCommunities,
+                                       levelArena, scratch);
+            levelVertices = numCommunities;
+        }
+
+        Result result(assignment, levels.back().modularity, totalIterations, converged);
+        result.levels = levels;
+        return result;
     }
     
     static std::vector<std::vector<size_t>> getCommunityMembers(const Result& result) {
@@ -231,8 +417,9 @@ public:
         return communityMembers;
     }
     
+    template <typename GraphT>
     static std::vector<std::pair<size_t, size_t>> getCommunityEdges(
-        const Graph& graph, const Result& result) {
+        const GraphT& graph, const Result& result) {
         std::vector<std::pair<size_t, size_t>> edges;
         
         for (size_t i = 0; i < static_cast<size_t>(graph.getNumVertices()); ++i) {
@@ -252,8 +439,9 @@ public:
         return edges;
     }
     
+    template <typename GraphT>
     static double calculateConductance(
-        const Graph& graph, const std::vector<size_t>& community) {
+        const GraphT& graph, const std::vector<size_t>& community) {
         if (community.empty()) {
             throw std::invalid_argument("Community is empty");
         }
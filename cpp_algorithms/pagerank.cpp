@@ -8,15 +8,29 @@
 #include <algorithm>
 #include <stdexcept>
 #include <iomanip>
+#include <thread>
+#include <deque>
+#include <cstdint>
+#include <atomic>
+#include "top_k.h"
+#include "edge_list_reader.h"
+#include "graph_io.h"
+#include "results_writer.h"
+#include "graph_shards.h"
+#include "instrumentation.h"
 
 struct Edge {
     int source;
     int target;
-    
-    Edge(int s, int t) : source(s), target(t) {
+    double weight;
+
+    Edge(int s, int t, double w = 1.0) : source(s), target(t), weight(w) {
         if (s < 0 || t < 0) {
             throw std::invalid_argument("Node IDs cannot be negative");
         }
+        if (w <= 0.0) {
+            throw std::invalid_argument("Edge weight must be positive");
+        }
     }
 };
 
@@ -26,16 +40,125 @@ private:
     int num_edges;
     std::vector<std::vector<int>> outgoing_links;
     std::vector<std::vector<int>> incoming_links;
+    std::vector<std::vector<double>> incoming_weights; // ::::: parallel to incoming_links
     std::vector<double> scores;
+    std::vector<double> personalization; // ::::: empty = uniform teleport
     double damping_factor;
     int max_iterations;
     double convergence_threshold;
+    int num_threads;
     bool computed;
+    int last_iterations = 0;  // ::::: sweeps run by the last compute call
+
+    // ::::: Compact link arrays built once before computing: uint32 ids in
+    // ::::: flat CSR-style rows instead of nested int vectors. Half the
+    // ::::: bytes per edge means the bandwidth-bound update sweep streams
+    // ::::: twice the edges per byte of memory traffic.
+    std::vector<uint64_t> in_offsets;
+    std::vector<uint32_t> in_sources;
+    std::vector<float> in_weights;       // ::::: aligned with in_sources
+    std::vector<uint64_t> out_offsets;
+    std::vector<uint32_t> out_targets;
+    std::vector<uint32_t> out_degrees;
+    std::vector<double> out_strength;    // ::::: sum of outgoing edge weights
+    std::vector<int> dangling_nodes;     // ::::: no out-edges; mass redistributed
+
+    // ::::: Teleport mass landing on a node each step
+    double restart_mass(int node) const {
+        return personalization.empty() ? 1.0 / num_nodes : personalization[node];
+    }
+
+    void collect_dangling_nodes() {
+        dangling_nodes.clear();
+        for (int node = 0; node < num_nodes; ++node) {
+            if (out_strength[node] <= 0.0) {
+                dangling_nodes.push_back(node);
+            }
+        }
+    }
+
+    // ::::: Mass sitting on dangling nodes this sweep, spread uniformly so
+    // ::::: the iteration's fixed point stays normalized. Without this the
+    // ::::: fixed point sums below 1 and warm starts from normalized saved
+    // ::::: scores carry excess mass that decays a damping factor per sweep.
+    double dangling_share() const {
+        double mass = 0.0;
+        for (int node : dangling_nodes) {
+            mass += scores[node];
+        }
+        return damping_factor * mass / num_nodes;
+    }
+
+    // ::::: Flatten the nested adjacency into the compact arrays and release
+    // ::::: the per-node vectors; edges cannot be added afterwards
+    void build_link_arrays() {
+        if (!in_offsets.empty()) {
+            return;
+        }
+
+        in_offsets.resize(num_nodes + 1, 0);
+        out_offsets.resize(num_nodes + 1, 0);
+        out_degrees.resize(num_nodes);
+        for (int node = 0; node < num_nodes; ++node) {
+            in_offsets[node + 1] = in_offsets[node] + incoming_links[node].size();
+            out_offsets[node + 1] = out_offsets[node] + outgoing_links[node].size();
+            out_degrees[node] = static_cast<uint32_t>(outgoing_links[node].size());
+        }
+
+        in_sources.resize(in_offsets[num_nodes]);
+        in_weights.resize(in_offsets[num_nodes]);
+        out_targets.resize(out_offsets[num_nodes]);
+        out_strength.assign(num_nodes, 0.0);
+        for (int node = 0; node < num_nodes; ++node) {
+            uint64_t in_slot = in_offsets[node];
+            for (size_t i = 0; i < incoming_links[node].size(); ++i) {
+                int incoming = incoming_links[node][i];
+                double weight = incoming_weights[node][i];
+                in_sources[in_slot] = static_cast<uint32_t>(incoming);
+                in_weights[in_slot] = static_cast<float>(weight);
+                out_strength[incoming] += weight;
+                in_slot++;
+            }
+            uint64_t out_slot = out_offsets[node];
+            for (int target : outgoing_links[node]) {
+                out_targets[out_slot++] = static_cast<uint32_t>(target);
+            }
+        }
+
+        std::vector<std::vector<int>>().swap(incoming_links);
+        std::vector<std::vector<int>>().swap(outgoing_links);
+        std::vector<std::vector<double>>().swap(incoming_weights);
+
+        collect_dangling_nodes();
+    }
+
+    // ::::: Compute new scores for the node range [begin, end) and return
+    // ::::: the partial L1 difference for the convergence check
+    double compute_range(int begin, int end, double dangling, std::vector<double>& new_scores) const {
+        double diff = 0.0;
+        for (int node = begin; node < end; ++node) {
+            // ::::: Add teleport mass plus this sweep's dangling share
+            double score = (1.0 - damping_factor) * restart_mass(node) + dangling;
+
+            // ::::: Add weighted score from incoming links; every in-neighbor
+            // ::::: has at least this edge, so its out-strength is positive
+            for (uint64_t e = in_offsets[node]; e < in_offsets[node + 1]; ++e) {
+                uint32_t incoming = in_sources[e];
+                score += damping_factor * scores[incoming] * in_weights[e] / out_strength[incoming];
+            }
+
+            new_scores[node] = score;
+            diff += std::abs(score - scores[node]);
+        }
+        return diff;
+    }
 
 public:
-    PageRank(int nodes, int edges, double damping = 0.85, int iterations = 100, double threshold = 1e-6)
-        : num_nodes(nodes), num_edges(edges), damping_factor(damping), 
-          max_iterations(iterations), convergence_threshold(threshold), computed(false) {
+    PageRank(int nodes, int edges, double damping = 0.85, int iterations = 100, double threshold = 1e-6,
+             int threads = 1)
+        : num_nodes(nodes), num_edges(edges), damping_factor(damping),
+          max_iterations(iterations), convergence_threshold(threshold), num_threads(threads),
+          computed(false) {
         if (nodes <= 0) {
             throw std::invalid_argument("Number of nodes must be positive");
         }
@@ -51,63 +174,183 @@ public:
         if (threshold <= 0.0) {
             throw std::invalid_argument("Convergence threshold must be positive");
         }
-        
+        if (threads <= 0) {
+            throw std::invalid_argument("Number of threads must be positive");
+        }
+
         outgoing_links.resize(num_nodes);
         incoming_links.resize(num_nodes);
+        incoming_weights.resize(num_nodes);
         scores.resize(num_nodes, 1.0 / num_nodes); // Initialize with equal probabilities
     }
     
-    void add_edge(int source, int target) {
+    void add_edge(int source, int target, double weight = 1.0) {
+        if (!in_offsets.empty()) {
+            throw std::runtime_error("Cannot add edges after computation has started");
+        }
         if (source < 0 || source >= num_nodes) {
             throw std::out_of_range("Source node ID out of range");
         }
         if (target < 0 || target >= num_nodes) {
             throw std::out_of_range("Target node ID out of range");
         }
-        
-        // ::::: Check if edge already exists
-        if (std::find(outgoing_links[source].begin(), outgoing_links[source].end(), target) 
-            == outgoing_links[source].end()) {
+        if (weight <= 0.0) {
+            throw std::invalid_argument("Edge weight must be positive");
+        }
+
+        // ::::: Check if edge already exists; duplicates update the weight
+        auto existing = std::find(incoming_links[target].begin(), incoming_links[target].end(), source);
+        if (existing == incoming_links[target].end()) {
             outgoing_links[source].push_back(target);
             incoming_links[target].push_back(source);
+            incoming_weights[target].push_back(weight);
+        } else {
+            incoming_weights[target][existing - incoming_links[target].begin()] = weight;
+        }
+    }
+
+    // ::::: Personalized teleport: restart mass proportional to the given
+    // ::::: distribution over a seed set (zeros everywhere else), so scores
+    // ::::: rank nodes relative to those seeds instead of globally
+    void set_personalization(const std::vector<double>& restart) {
+        if (restart.size() != static_cast<size_t>(num_nodes)) {
+            throw std::invalid_argument("Personalization vector size does not match node count");
+        }
+        double sum = 0.0;
+        for (double mass : restart) {
+            if (mass < 0.0) {
+                throw std::invalid_argument("Personalization masses cannot be negative");
+            }
+            sum += mass;
+        }
+        if (sum <= 0.0) {
+            throw std::invalid_argument("Personalization vector must have positive mass");
+        }
+        personalization.resize(num_nodes);
+        for (int node = 0; node < num_nodes; ++node) {
+            personalization[node] = restart[node] / sum;
         }
     }
     
+    // ::::: Bulk load from a CSR-style graph (e.g. a mapped graph file):
+    // ::::: fills the compact link arrays directly with one counting-sort
+    // ::::: transpose, skipping the nested per-node vectors and add_edge's
+    // ::::: duplicate scan entirely
+    template <typename GraphT>
+    void load_graph(const GraphT& graph) {
+        if (!in_offsets.empty()) {
+            throw std::runtime_error("Cannot load a graph after computation has started");
+        }
+        if (graph.getNumVertices() > num_nodes) {
+            throw std::invalid_argument("Graph vertex count exceeds the node count");
+        }
+
+        int loaded = graph.getNumVertices();
+        in_offsets.assign(num_nodes + 1, 0);
+        out_offsets.assign(num_nodes + 1, 0);
+        out_degrees.assign(num_nodes, 0);
+        out_strength.assign(num_nodes, 0.0);
+        for (int node = 0; node < loaded; ++node) {
+            uint32_t degree = 0;
+            for (const auto& [target, _] : graph.getNeighbors(node)) {
+                in_offsets[target + 1]++;
+                degree++;
+            }
+            out_offsets[node + 1] = degree;
+            out_degrees[node] = degree;
+        }
+        for (int node = 0; node < num_nodes; ++node) {
+            in_offsets[node + 1] += in_offsets[node];
+            out_offsets[node + 1] += out_offsets[node];
+        }
+
+        in_sources.resize(in_offsets[num_nodes]);
+        in_weights.resize(in_offsets[num_nodes]);
+        out_targets.resize(out_offsets[num_nodes]);
+        {
+            std::vector<uint64_t> cursor(in_offsets.begin(), in_offsets.end() - 1);
+            for (int node = 0; node < loaded; ++node) {
+                uint64_t out_slot = out_offsets[node];
+                for (const auto& [target, weight] : graph.getNeighbors(node)) {
+                    in_sources[cursor[target]] = static_cast<uint32_t>(node);
+                    in_weights[cursor[target]] = static_cast<float>(weight);
+                    cursor[target]++;
+                    out_targets[out_slot++] = static_cast<uint32_t>(target);
+                    out_strength[node] += weight;
+                }
+            }
+        }
+
+        std::vector<std::vector<int>>().swap(incoming_links);
+        std::vector<std::vector<int>>().swap(outgoing_links);
+        std::vector<std::vector<double>>().swap(incoming_weights);
+
+        collect_dangling_nodes();
+    }
+
+    // ::::: Warm start: resume from a previous run's scores instead of the
+    // ::::: uniform vector. After a small edge delta the old scores are close
+    // ::::: to the fixed point and convergence takes a handful of sweeps.
+    void set_scores(const std::vector<double>& warm_scores) {
+        if (warm_scores.size() != static_cast<size_t>(num_nodes)) {
+            throw std::invalid_argument("Warm-start score count does not match node count");
+        }
+        double sum = 0.0;
+        for (double score : warm_scores) {
+            if (score < 0.0) {
+                throw std::invalid_argument("Warm-start scores cannot be negative");
+            }
+            sum += score;
+        }
+        if (sum <= 0.0) {
+            throw std::invalid_argument("Warm-start scores must have positive mass");
+        }
+        for (int node = 0; node < num_nodes; ++node) {
+            scores[node] = warm_scores[node] / sum;
+        }
+    }
+
     void compute() {
+        build_link_arrays();
         std::vector<double> new_scores(num_nodes, 0.0);
-        double base_score = (1.0 - damping_factor) / num_nodes;
         int actual_iterations = 0;
         
+        int threads = std::min(num_threads, num_nodes);
+
         for (int iteration = 0; iteration < max_iterations; ++iteration) {
-            // ::::: Reset new scores
-            std::fill(new_scores.begin(), new_scores.end(), 0.0);
-            
-            // ::::: Calculate new scores
-            for (int node = 0; node < num_nodes; ++node) {
-                // ::::: Add base score
-                new_scores[node] = base_score;
-                
-                // ::::: Add score from incoming links
-                for (int incoming : incoming_links[node]) {
-                    int out_degree = outgoing_links[incoming].size();
-                    if (out_degree > 0) {
-                        new_scores[node] += damping_factor * scores[incoming] / out_degree;
-                    } else {
-                        // ::::: Handle dangling nodes
-                        new_scores[node] += damping_factor * scores[incoming] / num_nodes;
-                    }
-                }
-            }
-            
-            // ::::: Check for convergence
             double diff = 0.0;
-            for (int node = 0; node < num_nodes; ++node) {
-                diff += std::abs(new_scores[node] - scores[node]);
+            double dangling = dangling_share();
+
+            if (threads <= 1) {
+                // ::::: Single-threaded path
+                diff = compute_range(0, num_nodes, dangling, new_scores);
+            } else {
+                // ::::: Partition the node range across threads; each worker
+                // ::::: writes a disjoint slice of new_scores and accumulates
+                // ::::: its own convergence partial sum
+                std::vector<std::thread> workers;
+                std::vector<double> partial_diffs(threads, 0.0);
+                int chunk = (num_nodes + threads - 1) / threads;
+
+                for (int t = 0; t < threads; ++t) {
+                    int begin = t * chunk;
+                    int end = std::min(num_nodes, begin + chunk);
+                    workers.emplace_back([this, t, begin, end, dangling, &new_scores, &partial_diffs]() {
+                        partial_diffs[t] = compute_range(begin, end, dangling, new_scores);
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                for (double partial : partial_diffs) {
+                    diff += partial;
+                }
             }
-            
-            // ::::: Update scores
-            scores = new_scores;
+
+            // ::::: Update scores (every entry was rewritten, so swap suffices)
+            scores.swap(new_scores);
             actual_iterations = iteration + 1;
+            Instrumentation::addSample("pagerank.delta", diff);
             
             // ::::: If converged, stop early
             if (diff < convergence_threshold) {
@@ -115,10 +358,15 @@ public:
                 break;
             }
         }
+
+        Instrumentation::addCount("pagerank.iterations", actual_iterations);
+        Instrumentation::addCount("pagerank.edge_traversals",
+                                  static_cast<uint64_t>(actual_iterations) * num_edges);
         
         if (actual_iterations == max_iterations) {
             std::cout << "Warning: Maximum iterations reached without convergence." << std::endl;
         }
+        last_iterations = actual_iterations;
         
         // ::::: Normalize scores
         double sum = 0.0;
@@ -132,12 +380,347 @@ public:
         computed = true;
     }
     
+    // ::::: Sharded mode for multi-socket boxes: the destination range is cut
+    // ::::: into edge-balanced shards, one persistent worker per shard. Each
+    // ::::: worker copies its slice of the in-edge arrays into memory it
+    // ::::: touches first — first-touch placement keeps the slice on the
+    // ::::: worker's own socket — and sweeps only its own destinations every
+    // ::::: iteration, so edge traffic stays socket-local instead of crossing
+    // ::::: the interconnect. Workers meet at a barrier for the merge step:
+    // ::::: shard 0 reduces the convergence partials and swaps the score
+    // ::::: vectors before the next sweep starts. The compute()/thread path
+    // ::::: re-partitions the shared arrays every iteration; this one keeps
+    // ::::: workers and their local edges alive across the whole run.
+    void compute_sharded(int num_shards = 0) {
+        build_link_arrays();
+        if (num_shards <= 0) {
+            num_shards = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        auto ranges = ShardPlan::partition(in_offsets, num_shards);
+        int shards = static_cast<int>(ranges.size());
+
+        std::vector<double> new_scores(num_nodes, 0.0);
+        std::vector<double> partial_diffs(shards, 0.0);
+        ShardBarrier barrier(shards);
+        std::atomic<bool> done{false};
+        int actual_iterations = 0;   // ::::: written by shard 0 between barriers
+        double shared_dangling = dangling_share();
+        bool converged = false;
+
+        std::vector<std::thread> workers;
+        for (int s = 0; s < shards; ++s) {
+            workers.emplace_back([&, s]() {
+                auto [range_begin, range_end] = ranges[s];
+
+                // ::::: Shard-local copies of this destination range's edges
+                uint64_t edge_begin = in_offsets[range_begin];
+                uint64_t edge_end = in_offsets[range_end];
+                std::vector<uint64_t> local_offsets(range_end - range_begin + 1);
+                for (int node = range_begin; node <= range_end; ++node) {
+                    local_offsets[node - range_begin] = in_offsets[node] - edge_begin;
+                }
+                std::vector<uint32_t> local_sources(in_sources.begin() + edge_begin,
+                                                    in_sources.begin() + edge_end);
+                std::vector<float> local_weights(in_weights.begin() + edge_begin,
+                                                 in_weights.begin() + edge_end);
+
+                for (int iteration = 0; iteration < max_iterations; ++iteration) {
+                    // ::::: Sweep this shard's destinations against the local
+                    // ::::: edge slice; scores and the dangling share are
+                    // ::::: read-only until the merge
+                    double diff = 0.0;
+                    double dangling = shared_dangling;
+                    for (int node = range_begin; node < range_end; ++node) {
+                        double score = (1.0 - damping_factor) * restart_mass(node) + dangling;
+                        uint64_t first = local_offsets[node - range_begin];
+                        uint64_t last = local_offsets[node - range_begin + 1];
+                        for (uint64_t e = first; e < last; ++e) {
+                            uint32_t incoming = local_sources[e];
+                            score += damping_factor * scores[incoming] * local_weights[e] /
+                                     out_strength[incoming];
+                        }
+                        new_scores[node] = score;
+                        diff += std::abs(score - scores[node]);
+                    }
+                    partial_diffs[s] = diff;
+
+                    // ::::: Merge step: every shard finished its sweep
+                    barrier.wait();
+                    if (s == 0) {
+                        double total = 0.0;
+                        for (double partial : partial_diffs) {
+                            total += partial;
+                        }
+                        scores.swap(new_scores);
+                        shared_dangling = dangling_share();
+                        actual_iterations = iteration + 1;
+                        Instrumentation::addSample("pagerank.delta", total);
+                        if (total < convergence_threshold) {
+                            done.store(true);
+                        }
+                    }
+                    barrier.wait();
+                    if (done.load()) {
+                        break;
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        converged = done.load();
+
+        if (converged) {
+            std::cout << "Converged after " << actual_iterations << " iterations ("
+                      << shards << " shards)." << std::endl;
+        } else {
+            std::cout << "Warning: Maximum iterations reached without convergence." << std::endl;
+        }
+
+        Instrumentation::addCount("pagerank.iterations", actual_iterations);
+        Instrumentation::addCount("pagerank.edge_traversals",
+                                  static_cast<uint64_t>(actual_iterations) * num_edges);
+        last_iterations = actual_iterations;
+
+        // ::::: Normalize scores
+        double sum = 0.0;
+        for (double score : scores) {
+            sum += score;
+        }
+        for (double& score : scores) {
+            score /= sum;
+        }
+
+        computed = true;
+    }
+
+    // ::::: Adaptive mode: Gauss-Seidel in-place updates driven by a work
+    // ::::: queue. A node is re-processed only when an in-neighbor's score
+    // ::::: moved enough to change its incoming mass; on power-law graphs most
+    // ::::: nodes settle after a few updates and drop out of the queue early.
+    void compute_adaptive() {
+        build_link_arrays();
+        double node_threshold = convergence_threshold / num_nodes;
+
+        // ::::: Start with every node pending
+        std::deque<int> queue;
+        std::vector<char> queued(num_nodes, 1);
+        for (int node = 0; node < num_nodes; ++node) {
+            queue.push_back(node);
+        }
+
+        long long processed = 0;
+        long long budget = static_cast<long long>(max_iterations) * num_nodes;
+
+        // ::::: The dangling share is frozen while the queue drains and
+        // ::::: refreshed between drains, since recomputing it per relaxation
+        // ::::: would touch every dangling node each step
+        double dangling = dangling_share();
+
+        uint64_t edge_touches = 0;
+        while (!queue.empty() && processed < budget) {
+            int node = queue.front();
+            queue.pop_front();
+            queued[node] = 0;
+            processed++;
+
+            // ::::: Recompute this node's score in place from current values
+            double score = (1.0 - damping_factor) * restart_mass(node) + dangling;
+            for (uint64_t e = in_offsets[node]; e < in_offsets[node + 1]; ++e) {
+                uint32_t incoming = in_sources[e];
+                score += damping_factor * scores[incoming] * in_weights[e] / out_strength[incoming];
+            }
+            edge_touches += in_offsets[node + 1] - in_offsets[node];
+
+            double delta = std::abs(score - scores[node]);
+            scores[node] = score;
+
+            // ::::: Propagate only meaningful changes to the out-neighbors
+            if (delta > node_threshold) {
+                for (uint64_t e = out_offsets[node]; e < out_offsets[node + 1]; ++e) {
+                    uint32_t target = out_targets[e];
+                    if (!queued[target]) {
+                        queued[target] = 1;
+                        queue.push_back(target);
+                    }
+                }
+            }
+
+            // ::::: Queue drained: refresh the dangling share, and re-enqueue
+            // ::::: everything if it moved materially — it feeds every node.
+            // ::::: Each dangling score carries the share once, so the raw
+            // ::::: refresh is damped by the dangling fraction; dividing that
+            // ::::: out jumps the share subsystem straight to its fixed point
+            // ::::: instead of decaying there one drain at a time.
+            if (queue.empty()) {
+                double feedback =
+                    damping_factor * dangling_nodes.size() / num_nodes;
+                double refreshed =
+                    (dangling_share() - feedback * dangling) / (1.0 - feedback);
+                if (std::abs(refreshed - dangling) > node_threshold) {
+                    dangling = refreshed;
+                    for (int pending = 0; pending < num_nodes; ++pending) {
+                        queued[pending] = 1;
+                        queue.push_back(pending);
+                    }
+                }
+            }
+        }
+
+        if (queue.empty()) {
+            std::cout << "Converged after " << processed << " node updates ("
+                      << (processed + num_nodes - 1) / num_nodes << " full-sweep equivalents)." << std::endl;
+        } else {
+            std::cout << "Warning: Update budget reached without convergence." << std::endl;
+        }
+
+        Instrumentation::addCount("pagerank.adaptive_relaxations", static_cast<uint64_t>(processed));
+        Instrumentation::addCount("pagerank.edge_traversals", edge_touches);
+        last_iterations = static_cast<int>((processed + num_nodes - 1) / num_nodes);
+
+        // ::::: Normalize scores
+        double sum = 0.0;
+        for (double score : scores) {
+            sum += score;
+        }
+        for (double& score : scores) {
+            score /= sum;
+        }
+
+        computed = true;
+    }
+
+    // ::::: Batch personalized mode: iterate several restart vectors in one
+    // ::::: blocked pass, scores laid out node-major so every edge touched
+    // ::::: updates all vectors at once. Amortizing edge traffic across the
+    // ::::: block is what makes per-user ranking batches affordable.
+    std::vector<std::vector<double>> compute_batch(const std::vector<std::vector<double>>& restart_vectors) {
+        if (restart_vectors.empty()) {
+            throw std::invalid_argument("Batch requires at least one restart vector");
+        }
+        build_link_arrays();
+
+        int block = static_cast<int>(restart_vectors.size());
+        std::vector<double> base(static_cast<size_t>(num_nodes) * block);
+        std::vector<double> current(static_cast<size_t>(num_nodes) * block);
+        for (int b = 0; b < block; ++b) {
+            const auto& restart = restart_vectors[b];
+            if (restart.size() != static_cast<size_t>(num_nodes)) {
+                throw std::invalid_argument("Restart vector size does not match node count");
+            }
+            double sum = 0.0;
+            for (double mass : restart) {
+                if (mass < 0.0) {
+                    throw std::invalid_argument("Restart masses cannot be negative");
+                }
+                sum += mass;
+            }
+            if (sum <= 0.0) {
+                throw std::invalid_argument("Restart vectors must have positive mass");
+            }
+            for (int node = 0; node < num_nodes; ++node) {
+                double mass = restart[node] / sum;
+                base[static_cast<size_t>(node) * block + b] = (1.0 - damping_factor) * mass;
+                current[static_cast<size_t>(node) * block + b] = mass;
+            }
+        }
+
+        std::vector<double> next(current.size());
+        int threads = std::min(num_threads, num_nodes);
+
+        // ::::: One node range: all restart vectors advanced per edge touch.
+        // ::::: Each vector carries its own dangling share, spread uniformly
+        // ::::: like compute() does, so both entry points agree on graphs
+        // ::::: with dangling nodes.
+        auto sweep_range = [&](int begin, int end, const std::vector<double>& dangling,
+                               std::vector<double>& diffs) {
+            for (int node = begin; node < end; ++node) {
+                double* acc = next.data() + static_cast<size_t>(node) * block;
+                const double* seed = base.data() + static_cast<size_t>(node) * block;
+                for (int b = 0; b < block; ++b) acc[b] = seed[b] + dangling[b];
+
+                for (uint64_t e = in_offsets[node]; e < in_offsets[node + 1]; ++e) {
+                    uint32_t incoming = in_sources[e];
+                    double share = damping_factor * in_weights[e] / out_strength[incoming];
+                    const double* from = current.data() + static_cast<size_t>(incoming) * block;
+                    for (int b = 0; b < block; ++b) acc[b] += share * from[b];
+                }
+
+                const double* old = current.data() + static_cast<size_t>(node) * block;
+                for (int b = 0; b < block; ++b) diffs[b] += std::abs(acc[b] - old[b]);
+            }
+        };
+
+        for (int iteration = 0; iteration < max_iterations; ++iteration) {
+            // ::::: Mass sitting on dangling nodes this sweep, per vector
+            std::vector<double> dangling(block, 0.0);
+            for (int node : dangling_nodes) {
+                const double* row = current.data() + static_cast<size_t>(node) * block;
+                for (int b = 0; b < block; ++b) dangling[b] += row[b];
+            }
+            for (int b = 0; b < block; ++b) {
+                dangling[b] *= damping_factor / num_nodes;
+            }
+
+            std::vector<double> diffs(block, 0.0);
+            if (threads <= 1) {
+                sweep_range(0, num_nodes, dangling, diffs);
+            } else {
+                std::vector<std::thread> workers;
+                std::vector<std::vector<double>> partial(threads, std::vector<double>(block, 0.0));
+                int chunk = (num_nodes + threads - 1) / threads;
+                for (int t = 0; t < threads; ++t) {
+                    int begin = t * chunk;
+                    int end = std::min(num_nodes, begin + chunk);
+                    workers.emplace_back([&, t, begin, end]() {
+                        sweep_range(begin, end, dangling, partial[t]);
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                for (const auto& part : partial) {
+                    for (int b = 0; b < block; ++b) diffs[b] += part[b];
+                }
+            }
+
+            current.swap(next);
+            if (*std::max_element(diffs.begin(), diffs.end()) < convergence_threshold) {
+                break;
+            }
+        }
+
+        // ::::: Unblock into one normalized score vector per restart vector
+        std::vector<std::vector<double>> results(block, std::vector<double>(num_nodes));
+        for (int b = 0; b < block; ++b) {
+            double sum = 0.0;
+            for (int node = 0; node < num_nodes; ++node) {
+                sum += current[static_cast<size_t>(node) * block + b];
+            }
+            for (int node = 0; node < num_nodes; ++node) {
+                results[b][node] = current[static_cast<size_t>(node) * block + b] / sum;
+            }
+        }
+        return results;
+    }
+
     std::vector<double> get_scores() const {
         if (!computed) {
             throw std::runtime_error("PageRank scores have not been computed yet");
         }
         return scores;
     }
+
+    // ::::: Sweeps run by the last compute call (full-sweep equivalents in
+    // ::::: adaptive mode)
+    int get_iterations() const {
+        if (!computed) {
+            throw std::runtime_error("PageRank scores have not been computed yet");
+        }
+        return last_iterations;
+    }
     
     std::vector<std::pair<int, double>> get_top_nodes(int k) const {
         if (!computed) {
@@ -147,18 +730,8 @@ public:
             throw std::invalid_argument("Number of top nodes must be positive");
         }
         
-        std::vector<std::pair<int, double>> ranked_nodes;
-        for (int i = 0; i < num_nodes; ++i) {
-            ranked_nodes.push_back({i, scores[i]});
-        }
-        
-        std::sort(ranked_nodes.begin(), ranked_nodes.end(),
-                 [](const auto& a, const auto& b) { return a.second > b.second; });
-        
-        return std::vector<std::pair<int, double>>(
-            ranked_nodes.begin(),
-            ranked_nodes.begin() + std::min(k, num_nodes)
-        );
+        // ::::: Bounded-heap selection; no full-size temporary or O(n log n) sort
+        return TopK::select(scores, k);
     }
     
     double get_score(int node) const {
@@ -179,101 +752,205 @@ public:
 };
 
 bool read_graph_from_file(const std::string& filename, PageRank& pagerank) {
+    // ::::: Chunked parallel parse; the header line is skipped, and edges
+    // ::::: with out-of-range ids are reported the way per-line parsing did
+    for (const auto& edge : EdgeListReader::read(filename, 0, 1)) {
+        try {
+            pagerank.add_edge(edge.from, edge.to, edge.weight);
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: " << e.what() << " for edge " << edge.from
+                      << " -> " << edge.to << std::endl;
+        }
+    }
+    return true;
+}
+
+// ::::: Read a previous run's output for warm starts: binary results files
+// ::::: are detected by magic, anything else is parsed as 'node score' lines
+std::vector<double> read_scores_from_file(const std::string& filename, int num_nodes) {
+    std::vector<double> scores(num_nodes, 0.0);
+
+    if (ResultsWriter::isBinaryResultsFile(filename)) {
+        auto results = ResultsWriter::readBinary(filename);
+        if (results.columns.empty()) {
+            throw std::runtime_error("Results file has no score column: " + filename);
+        }
+        for (size_t i = 0; i < results.nodes.size(); ++i) {
+            if (results.nodes[i] >= 0 && results.nodes[i] < num_nodes) {
+                scores[results.nodes[i]] = results.columns[0][i];
+            }
+        }
+        return scores;
+    }
+
     std::ifstream file(filename);
     if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
+        throw std::runtime_error("Could not open warm-start file: " + filename);
     }
-    
-    // ::::: Skip header line
+
     std::string line;
-    std::getline(file, line);
-    
-    // ::::: Read edges
-    int line_number = 2;
     while (std::getline(file, line)) {
         std::istringstream iss(line);
-        int source, target;
-        if (!(iss >> source >> target)) {
-            std::cerr << "Warning: Invalid edge format at line " << line_number << ": " << line << std::endl;
-            continue;
-        }
-        try {
-            pagerank.add_edge(source, target);
-        } catch (const std::exception& e) {
-            std::cerr << "Warning: " << e.what() << " at line " << line_number << std::endl;
+        int node;
+        double score;
+        if (!(iss >> node >> score)) continue;
+        if (node >= 0 && node < num_nodes) {
+            scores[node] = score;
         }
-        line_number++;
     }
-    
-    file.close();
-    return true;
+    return scores;
 }
 
-bool write_results_to_file(const std::string& filename, const std::vector<double>& scores, int precision = 6) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open output file: " + filename);
-    }
-    
-    file << std::fixed << std::setprecision(precision);
-    for (size_t i = 0; i < scores.size(); ++i) {
-        file << i << " " << scores[i] << std::endl;
+// ::::: Binary columnar by default; --text keeps the debug-friendly lines
+bool write_results_to_file(const std::string& filename, const std::vector<double>& scores,
+                           bool text_format = false, int precision = 6) {
+    if (text_format) {
+        ResultsWriter::writeText(filename, scores, precision);
+    } else {
+        ResultsWriter::writeBinary(filename, scores);
     }
-    
-    file.close();
     return true;
 }
 
+// ::::: The Python bindings include this file for the PageRank class and
+// ::::: provide their own module entry point instead of this CLI
+#ifndef PAGERANK_NO_MAIN
 int main(int argc, char* argv[]) {
     try {
+        // ::::: Separate flags from positional arguments
+        int num_threads = 1;
+        bool text_output = false;
+        bool emit_stats = false;
+        std::string mode = "full";
+        std::string warm_start_file;
+        std::string personalize_file;
+        std::vector<std::string> args;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--warm-start") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--warm-start requires a value");
+                }
+                warm_start_file = argv[++i];
+            } else if (arg == "--personalize") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--personalize requires a value");
+                }
+                personalize_file = argv[++i];
+            } else if (arg == "--text") {
+                text_output = true;
+            } else if (arg == "--stats") {
+                emit_stats = true;
+            } else if (arg == "--threads") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--threads requires a value");
+                }
+                num_threads = std::stoi(argv[++i]);
+            } else if (arg == "--mode") {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("--mode requires a value");
+                }
+                mode = argv[++i];
+                if (mode != "full" && mode != "adaptive" && mode != "sharded") {
+                    throw std::invalid_argument("--mode must be 'full', 'adaptive' or 'sharded'");
+                }
+            } else {
+                args.push_back(arg);
+            }
+        }
+
         // ::::: Check command line arguments
-        if (argc < 3) {
-            std::cerr << "Usage: " << argv[0] << " input_file output_file [damping_factor] [max_iterations] [convergence_threshold]" << std::endl;
+        if (args.size() < 2) {
+            std::cerr << "Usage: " << argv[0] << " input_file output_file [damping_factor] [max_iterations] [convergence_threshold] [--threads N] [--mode full|adaptive|sharded] [--warm-start scores_file] [--personalize restart_file] [--text] [--stats]" << std::endl;
             return 1;
         }
-        
-        std::string input_file = argv[1];
-        std::string output_file = argv[2];
-        
+
+        std::string input_file = args[0];
+        std::string output_file = args[1];
+        Instrumentation::enable(emit_stats);
+
         // ::::: Parse optional parameters
         double damping_factor = 0.85;
         int max_iterations = 100;
         double convergence_threshold = 1e-6;
+
+        if (args.size() > 2) damping_factor = std::stod(args[2]);
+        if (args.size() > 3) max_iterations = std::stoi(args[3]);
+        if (args.size() > 4) convergence_threshold = std::stod(args[4]);
         
-        if (argc > 3) damping_factor = std::stod(argv[3]);
-        if (argc > 4) max_iterations = std::stoi(argv[4]);
-        if (argc > 5) convergence_threshold = std::stod(argv[5]);
-        
-        // ::::: Read graph from file
-        std::ifstream file(input_file);
+        // ::::: Binary graph files (from graph_convert) are detected by
+        // ::::: magic and memory-mapped, so the load is a counting-sort
+        // ::::: transpose of the mapped arrays instead of a text parse;
+        // ::::: anything else goes through the edge-list reader
+        std::ifstream file(input_file, std::ios::binary);
         if (!file.is_open()) {
             throw std::runtime_error("Could not open input file: " + input_file);
         }
-        
+        uint32_t magic = 0;
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        file.close();
+        bool binary_graph = magic == GraphFileHeader::MAGIC;
+
         int num_nodes, num_edges;
-        std::string header_line;
-        std::getline(file, header_line);
-        std::istringstream iss(header_line);
-        
-        if (!(iss >> num_nodes >> num_edges)) {
-            throw std::runtime_error("Invalid header format");
+        if (binary_graph) {
+            MappedCSRGraph probe(input_file);
+            num_nodes = probe.getNumVertices();
+            num_edges = 0;
+            for (int node = 0; node < num_nodes; ++node) {
+                num_edges += static_cast<int>(probe.getNeighbors(node).size());
+            }
+        } else {
+            std::ifstream header(input_file);
+            std::string header_line;
+            std::getline(header, header_line);
+            std::istringstream iss(header_line);
+            if (!(iss >> num_nodes >> num_edges)) {
+                throw std::runtime_error("Invalid header format");
+            }
         }
-        
-        file.close();
-        
+
         // ::::: Initialize PageRank
-        PageRank pagerank(num_nodes, num_edges, damping_factor, max_iterations, convergence_threshold);
+        PageRank pagerank(num_nodes, num_edges, damping_factor, max_iterations, convergence_threshold, num_threads);
         
         // ::::: Read graph from file
-        read_graph_from_file(input_file, pagerank);
-        
+        {
+            Instrumentation::ScopedTimer timer("stage.load");
+            if (binary_graph) {
+                pagerank.load_graph(MappedCSRGraph(input_file));
+            } else {
+                read_graph_from_file(input_file, pagerank);
+            }
+        }
+
+        // ::::: Resume from a previous run's scores when requested
+        if (!warm_start_file.empty()) {
+            pagerank.set_scores(read_scores_from_file(warm_start_file, num_nodes));
+        }
+
+        // ::::: Restart distribution over a seed set ('node mass' per line)
+        if (!personalize_file.empty()) {
+            pagerank.set_personalization(read_scores_from_file(personalize_file, num_nodes));
+        }
+
         // ::::: Compute PageRank scores
         std::cout << "Computing PageRank for " << num_nodes << " nodes and " << num_edges << " edges" << std::endl;
         std::cout << "Parameters: damping_factor = " << damping_factor 
                   << ", max_iterations = " << max_iterations 
-                  << ", convergence_threshold = " << convergence_threshold << std::endl;
+                  << ", convergence_threshold = " << convergence_threshold
+                  << ", threads = " << num_threads
+                  << ", mode = " << mode << std::endl;
         
-        pagerank.compute();
+        {
+            Instrumentation::ScopedTimer timer("stage.compute");
+            if (mode == "adaptive") {
+                pagerank.compute_adaptive();
+            } else if (mode == "sharded") {
+                // ::::: --threads doubles as the shard count in sharded mode
+                pagerank.compute_sharded(num_threads);
+            } else {
+                pagerank.compute();
+            }
+        }
         
         // ::::: Get and display top 10 nodes
         auto top_nodes = pagerank.get_top_nodes(10);
@@ -283,12 +960,21 @@ int main(int argc, char* argv[]) {
         }
         
         // ::::: Write all results to file
-        write_results_to_file(output_file, pagerank.get_scores());
+        {
+            Instrumentation::ScopedTimer timer("stage.write");
+            write_results_to_file(output_file, pagerank.get_scores(), text_output);
+        }
         std::cout << "\nResults written to " << output_file << std::endl;
+
+        if (emit_stats) {
+            std::cout << Instrumentation::toJson() << std::endl;
+        }
         
         return 0;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         return 1;
     }
-} 
\ No newline at end of file
+}
+#endif
+ 
\ No newline at end of file
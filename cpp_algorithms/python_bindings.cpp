@@ -0,0 +1,196 @@
+// ::::: In-process Python bindings for the C++ algorithms. The backend used
+// ::::: to shell out to the compiled binaries through temp edge-list files
+// ::::: and parsed stdout, paying serialize/fork/parse on every call; this
+// ::::: module exposes the same classes directly and hands score arrays to
+// ::::: NumPy without copying (the vector is moved onto the heap and a
+// ::::: capsule deleter ties its lifetime to the array).
+// :::::
+// ::::: Built by compile_algorithms.py when pybind11 is importable:
+// :::::   g++ -std=c++17 -O3 -shared -fPIC $(python3 -m pybind11 --includes) \
+// :::::       python_bindings.cpp -o gitconnectx_native$(python3-config --extension-suffix)
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include "graph.h"
+#include "csr_graph.h"
+#include "compact_graph.h"
+#include "graph_build.cpp"
+#include "bfs_dfs.cpp"
+#include "dijkstra.cpp"
+#include "louvain.cpp"
+#include "kcore.cpp"
+#include "hits.cpp"
+
+#define PAGERANK_NO_MAIN
+#include "pagerank.cpp"
+
+namespace py = pybind11;
+
+// ::::: Move a score vector onto the heap and wrap it as a NumPy array that
+// ::::: owns it — zero copies between the algorithm and Python
+template <typename T>
+static py::array_t<T> movedArray(std::vector<T>&& values) {
+    auto* holder = new std::vector<T>(std::move(values));
+    py::capsule owner(holder, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+    return py::array_t<T>({holder->size()}, {sizeof(T)}, holder->data(), owner);
+}
+
+// ::::: View a result-struct vector in place; the owning Python object is
+// ::::: passed as the array base so the buffer outlives every view taken
+template <typename T>
+static py::array_t<T> viewArray(const std::vector<T>& values, py::handle owner) {
+    return py::array_t<T>({values.size()}, {sizeof(T)}, values.data(), owner);
+}
+
+PYBIND11_MODULE(gitconnectx_native, m) {
+    m.doc() = "GitConnectX graph algorithms (in-process, zero-copy NumPy output)";
+
+    py::class_<Graph>(m, "Graph")
+        .def(py::init<bool>(), py::arg("directed") = false)
+        .def("add_vertex", &Graph::addVertex)
+        .def("add_edge", &Graph::addEdge,
+             py::arg("from_vertex"), py::arg("to_vertex"), py::arg("weight") = 1.0)
+        .def("add_edge_unchecked", &Graph::addEdgeUnchecked,
+             py::arg("from_vertex"), py::arg("to_vertex"), py::arg("weight") = 1.0)
+        .def("finalize_edges", &Graph::finalizeEdges)
+        .def("remove_edge", &Graph::removeEdge)
+        .def("has_vertex", &Graph::hasVertex)
+        .def("has_edge", &Graph::hasEdge)
+        .def("get_edge_weight", &Graph::getEdgeWeight)
+        .def("get_neighbors",
+             [](const Graph& graph, int vertex) { return graph.getNeighbors(vertex); })
+        .def("get_vertices", &Graph::getVertices)
+        .def("num_vertices", &Graph::getNumVertices)
+        .def("num_edges", &Graph::getNumEdges)
+        .def("is_directed", &Graph::isDirectedGraph);
+
+    py::class_<GraphBuilder>(m, "GraphBuilder")
+        .def_static("from_edge_list", &GraphBuilder::buildFromEdgeList,
+                    py::arg("filename"), py::arg("directed") = false);
+
+    // ::::: PageRank keeps its own node-count/edge-count construction
+    py::class_<PageRank>(m, "PageRank")
+        .def(py::init<int, int, double, int, double, int>(),
+             py::arg("num_nodes"), py::arg("num_edges"), py::arg("damping") = 0.85,
+             py::arg("iterations") = 100, py::arg("threshold") = 1e-6,
+             py::arg("threads") = 1)
+        .def("add_edge", &PageRank::add_edge,
+             py::arg("source"), py::arg("target"), py::arg("weight") = 1.0)
+        .def("set_scores", &PageRank::set_scores)
+        .def("set_personalization", &PageRank::set_personalization)
+        .def("compute", &PageRank::compute, py::call_guard<py::gil_scoped_release>())
+        .def("compute_adaptive", &PageRank::compute_adaptive,
+             py::call_guard<py::gil_scoped_release>())
+        .def("compute_batch",
+             [](PageRank& pagerank, const std::vector<std::vector<double>>& restarts) {
+                 auto results = pagerank.compute_batch(restarts);
+                 py::list arrays;
+                 for (auto& scores : results) {
+                     arrays.append(movedArray(std::move(scores)));
+                 }
+                 return arrays;
+             })
+        .def("get_scores",
+             [](const PageRank& pagerank) { return movedArray(pagerank.get_scores()); })
+        .def("get_top_nodes", &PageRank::get_top_nodes);
+
+    py::class_<HITS::Scores>(m, "HITSScores")
+        .def_property_readonly("hub_scores",
+             [](py::object scores) {
+                 return viewArray(scores.cast<HITS::Scores&>().hubScores, scores);
+             })
+        .def_property_readonly("authority_scores",
+             [](py::object scores) {
+                 return viewArray(scores.cast<HITS::Scores&>().authorityScores, scores);
+             })
+        .def_readonly("iterations", &HITS::Scores::iterations)
+        .def_readonly("converged", &HITS::Scores::converged)
+        .def("summary", &HITS::Scores::getSummary, py::arg("top_k") = 5);
+
+    py::class_<HITS>(m, "HITS")
+        .def_static("calculate", &HITS::calculate<Graph>,
+                    py::arg("graph"), py::arg("max_iterations") = 100,
+                    py::arg("tolerance") = 1e-10,
+                    py::call_guard<py::gil_scoped_release>());
+
+    py::class_<KCore::Result>(m, "KCoreResult")
+        .def_property_readonly("core_numbers",
+             [](py::object result) {
+                 return viewArray(result.cast<KCore::Result&>().coreNumbers, result);
+             })
+        .def_readonly("max_core_number", &KCore::Result::maxCoreNumber)
+        .def("summary", &KCore::Result::getSummary);
+
+    py::class_<KCore>(m, "KCore")
+        .def_static("decompose", &KCore::decompose<Graph>,
+                    py::call_guard<py::gil_scoped_release>())
+        .def_static("update", &KCore::update<Graph>,
+                    py::arg("graph"), py::arg("previous"),
+                    py::arg("inserted_edges"), py::arg("removed_edges"),
+                    py::call_guard<py::gil_scoped_release>());
+
+    py::class_<Louvain::Result>(m, "LouvainResult")
+        .def_property_readonly("communities",
+             [](py::object result) {
+                 return viewArray(result.cast<Louvain::Result&>().communities, result);
+             })
+        .def_readonly("num_communities", &Louvain::Result::numCommunities)
+        .def_readonly("modularity", &Louvain::Result::modularity)
+        .def_readonly("iterations", &Louvain::Result::iterations)
+        .def_readonly("converged", &Louvain::Result::converged)
+        .def("summary", &Louvain::Result::getSummary);
+
+    py::class_<Louvain>(m, "Louvain")
+        .def_static("detect_communities", &Louvain::detectCommunities<Graph>,
+                    py::arg("graph"), py::arg("max_iterations") = 100,
+                    py::call_guard<py::gil_scoped_release>());
+
+    py::class_<Dijkstra::Result>(m, "DijkstraResult")
+        .def_property_readonly("distances",
+             [](py::object result) {
+                 return viewArray(result.cast<Dijkstra::Result&>().distances, result);
+             })
+        .def_readonly("previous", &Dijkstra::Result::previous)
+        .def("has_path_to", &Dijkstra::Result::hasPathTo)
+        .def("distance_to", &Dijkstra::Result::distanceTo);
+
+    py::class_<Dijkstra>(m, "Dijkstra")
+        .def_static("shortest_path", &Dijkstra::shortestPath<Graph>,
+                    py::call_guard<py::gil_scoped_release>())
+        .def_static("get_path", &Dijkstra::getPath)
+        .def_static("batch_shortest_paths",
+             [](const Graph& graph,
+                const std::vector<std::pair<int, std::vector<int>>>& queries,
+                int num_threads) {
+                 std::vector<Dijkstra::Query> converted;
+                 converted.reserve(queries.size());
+                 for (const auto& [source, targets] : queries) {
+                     converted.push_back({source, targets});
+                 }
+                 std::vector<std::vector<double>> results;
+                 {
+                     py::gil_scoped_release release;
+                     results = Dijkstra::batchShortestPaths(graph, converted, num_threads);
+                 }
+                 py::list arrays;
+                 for (auto& distances : results) {
+                     arrays.append(movedArray(std::move(distances)));
+                 }
+                 return arrays;
+             },
+             py::arg("graph"), py::arg("queries"), py::arg("num_threads") = 0);
+
+    py::class_<GraphTraversal>(m, "GraphTraversal")
+        .def_static("bfs", &GraphTraversal::bfs<Graph>,
+                    py::call_guard<py::gil_scoped_release>())
+        .def_static("bfs_level_synchronous", &GraphTraversal::bfsLevelSynchronous<Graph>,
+                    py::arg("graph"), py::arg("start_vertex"), py::arg("num_threads") = 0,
+                    py::call_guard<py::gil_scoped_release>())
+        .def_static("connected_components", &GraphTraversal::findConnectedComponents<Graph>,
+                    py::call_guard<py::gil_scoped_release>())
+        .def_static("connected_components_union_find",
+                    &GraphTraversal::findConnectedComponentsUnionFind<Graph>,
+                    py::call_guard<py::gil_scoped_release>());
+}
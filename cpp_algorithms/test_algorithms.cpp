@@ -1,14 +1,27 @@
 #include "graph.h"
+#include "csr_graph.h"
+#include "compact_graph.h"
+#include "graph_io.h"
+#include "landmark_index.h"
+#include "results_writer.h"
+#include "graph_build.cpp"
 #include "bfs_dfs.cpp"
 #include "dijkstra.cpp"
 #include "louvain.cpp"
 #include "kcore.cpp"
 #include "hits.cpp"
+
+#define TRIANGLES_NO_MAIN
+#include "triangles.cpp"
+
+#define BETWEENNESS_NO_MAIN
+#include "betweenness.cpp"
 #include <iostream>
 #include <iomanip>
 #include <vector>
 #include <string>
 #include <cassert>
+#include <fstream>
 
 // ::::: Helper functions for printing results
 void printVector(const std::vector<int>& vec, const std::string& name) {
@@ -38,9 +51,25 @@ void verifyBFS(const Graph& graph, int startVertex, const std::vector<int>& expe
     printVector(traversal, "Traversal");
     printVector(distances, "Distances");
     assert(distances == expectedDistances && "BFS distances do not match expected values!");
+
+    // ::::: The level-synchronous variant must agree on every distance
+    auto [parallelTraversal, parallelDistances] =
+        GraphTraversal::bfsLevelSynchronous(graph, startVertex, 2);
+    assert(parallelDistances == expectedDistances && "Level-synchronous BFS distances do not match!");
+    assert(parallelTraversal.size() == traversal.size() && "Level-synchronous BFS visited a different vertex count!");
     std::cout << "✓ BFS test passed\n";
 }
 
+void verifyComponents(const Graph& graph, size_t expectedCount) {
+    auto components = GraphTraversal::findConnectedComponents(graph);
+    auto unionFindComponents = GraphTraversal::findConnectedComponentsUnionFind(graph);
+    std::cout << "Components Test:\n";
+    std::cout << "Component count: " << components.size() << "\n";
+    assert(components.size() == expectedCount && "Component count does not match expected value!");
+    assert(unionFindComponents.size() == expectedCount && "Union-find component count does not match!");
+    std::cout << "✓ Components test passed\n";
+}
+
 void verifyDijkstra(const Graph& graph, int startVertex, const std::vector<double>& expectedDistances) {
     auto result = Dijkstra::shortestPath(graph, startVertex);
     std::cout << "\nDijkstra Test from vertex " << startVertex << ":\n";
@@ -100,7 +129,20 @@ void verifyDijkstra(const Graph& graph, int startVertex, const std::vector<doubl
     
     assert(result.distances.size() == expectedDistances.size() && "Distance vector size mismatch!");
     for (size_t i = 0; i < result.distances.size(); ++i) {
-        assert(std::abs(result.distances[i] - expectedDistances[i]) < 1e-6 && "Distance values do not match!");
+        if (expectedDistances[i] == std::numeric_limits<double>::infinity()) {
+            assert(result.distances[i] == std::numeric_limits<double>::infinity() && "Expected unreachable vertex!");
+        } else {
+            assert(std::abs(result.distances[i] - expectedDistances[i]) < 1e-6 && "Distance values do not match!");
+        }
+    }
+
+    // ::::: Batched queries must reproduce the full single-source distances
+    std::vector<int> allTargets(graph.getNumVertices());
+    for (size_t i = 0; i < allTargets.size(); ++i) allTargets[i] = static_cast<int>(i);
+    auto batchResults = Dijkstra::batchShortestPaths(graph, {{startVertex, allTargets}}, 2);
+    assert(batchResults.size() == 1 && "Batch result count mismatch!");
+    for (size_t i = 0; i < allTargets.size(); ++i) {
+        assert(batchResults[0][i] == result.distances[i] && "Batched Dijkstra distance does not match!");
     }
     std::cout << "✓ Dijkstra test passed\n";
 }
@@ -113,6 +155,16 @@ void verifyHITS(const Graph& graph, double expectedMaxHub, double expectedMaxAut
     const double tolerance = 1e-3;
     assert(std::abs(maxHub - expectedMaxHub) < tolerance && "Max hub score does not match!");
     assert(std::abs(maxAuth - expectedMaxAuth) < tolerance && "Max authority score does not match!");
+
+    // ::::: The sharded mode must agree with the single-threaded sweep
+    auto sharded = HITS::calculateSharded(graph, 3);
+    assert(sharded.converged == result.converged && "Sharded HITS convergence does not match!");
+    for (size_t v = 0; v < result.hubScores.size(); ++v) {
+        assert(std::abs(sharded.hubScores[v] - result.hubScores[v]) < 1e-9 &&
+               "Sharded hub scores do not match!");
+        assert(std::abs(sharded.authorityScores[v] - result.authorityScores[v]) < 1e-9 &&
+               "Sharded authority scores do not match!");
+    }
     std::cout << "✓ HITS test passed\n";
 }
 
@@ -123,6 +175,365 @@ void verifyKCore(const Graph& graph, int expectedMaxCore) {
     std::cout << "✓ K-Core test passed\n";
 }
 
+void verifyCSR(const Graph& graph) {
+    CSRGraph csr = CSRGraph::fromGraph(graph);
+    std::cout << "CSR Test:\n";
+    assert(csr.getNumVertices() == graph.getNumVertices() && "CSR vertex count does not match!");
+    assert(csr.getNumEdges() == graph.getNumEdges() && "CSR edge count does not match!");
+
+    // ::::: Every algorithm must produce identical results on both representations
+    auto [traversal, distances] = GraphTraversal::bfs(graph, 0);
+    auto [csrTraversal, csrDistances] = GraphTraversal::bfs(csr, 0);
+    assert(distances == csrDistances && "CSR BFS distances do not match!");
+
+    auto dijkstraResult = Dijkstra::shortestPath(graph, 0);
+    auto csrDijkstraResult = Dijkstra::shortestPath(csr, 0);
+    assert(dijkstraResult.distances == csrDijkstraResult.distances && "CSR Dijkstra distances do not match!");
+
+    auto coreResult = KCore::decompose(graph);
+    auto csrCoreResult = KCore::decompose(csr);
+    assert(coreResult.maxCoreNumber == csrCoreResult.maxCoreNumber && "CSR max core number does not match!");
+
+    std::cout << "✓ CSR test passed\n";
+}
+
+void verifyIncremental() {
+    std::cout << "Incremental Update Test:\n";
+
+    // ::::: A directed 4-cycle with a chord, decomposed once up front
+    Graph graph(true);
+    graph.addEdge(0, 1, 1.0);
+    graph.addEdge(1, 2, 1.0);
+    graph.addEdge(2, 3, 1.0);
+    graph.addEdge(3, 0, 1.0);
+    graph.addEdge(0, 2, 1.0);
+    auto before = KCore::decompose(graph);
+
+    // ::::: Apply a delta: close the reverse cycle, drop the chord
+    std::vector<std::pair<int, int>> inserted = {{1, 0}, {2, 1}, {3, 2}, {0, 3}};
+    std::vector<std::pair<int, int>> removed = {{0, 2}};
+    for (const auto& [u, v] : inserted) graph.addEdge(u, v, 1.0);
+    for (const auto& [u, v] : removed) {
+        bool existed = graph.removeEdge(u, v);
+        assert(existed && "Removed edge should have existed!");
+    }
+
+    // ::::: The repaired cores must match a full re-decomposition
+    auto repaired = KCore::update(graph, before, inserted, removed);
+    auto full = KCore::decompose(graph);
+    assert(repaired.coreNumbers == full.coreNumbers && "Repaired core numbers do not match full decompose!");
+    std::cout << "✓ Incremental update test passed\n";
+}
+
+void verifyCompact(const Graph& graph) {
+    CompactGraph compact = CompactGraph::fromGraph(graph);
+    std::cout << "Compact Graph Test:\n";
+    assert(compact.getNumVertices() == graph.getNumVertices() && "Compact vertex count does not match!");
+    assert(compact.getNumEdges() == static_cast<size_t>(graph.getNumEdges()) && "Compact edge count does not match!");
+
+    // ::::: The bandwidth-bound kernels must agree with the hash-map graph
+    auto coreResult = KCore::decompose(graph);
+    auto compactCoreResult = KCore::decompose(compact);
+    assert(coreResult.maxCoreNumber == compactCoreResult.maxCoreNumber && "Compact max core number does not match!");
+
+    auto hitsResult = HITS::calculate(graph);
+    auto compactHitsResult = HITS::calculate(compact);
+    for (size_t i = 0; i < hitsResult.hubScores.size(); ++i) {
+        assert(std::abs(hitsResult.hubScores[i] - compactHitsResult.hubScores[i]) < 1e-6 &&
+               "Compact HITS hub score does not match!");
+    }
+
+    // ::::: Dropping the weight column must leave unweighted kernels unchanged
+    CompactGraph unweighted = CompactGraph::fromGraph(graph, false);
+    assert(!unweighted.hasStoredWeights() && "Weight column should not be stored!");
+    assert(unweighted.getMemoryFootprint() < compact.getMemoryFootprint() &&
+           "Implicit weights should shrink the footprint!");
+    auto unweightedCore = KCore::decompose(unweighted);
+    assert(coreResult.maxCoreNumber == unweightedCore.maxCoreNumber && "Unweighted max core number does not match!");
+
+    std::cout << "✓ Compact graph test passed\n";
+}
+
+void verifyResultsWriter() {
+    std::cout << "Results Writer Test:\n";
+    const std::string path = "test_results.bin";
+
+    // ::::: Binary columnar round trip with explicit node ids
+    std::vector<int32_t> nodes = {4, 7, 19};
+    std::vector<double> first = {0.25, 0.5, 0.25};
+    std::vector<double> second = {1.0, 2.0, 3.0};
+    ResultsWriter::writeBinary(path, nodes, {&first, &second});
+    assert(ResultsWriter::isBinaryResultsFile(path) && "Binary magic probe failed!");
+
+    auto results = ResultsWriter::readBinary(path);
+    assert(results.nodes == nodes && "Round-tripped node ids do not match!");
+    assert(results.columns.size() == 2 && "Round-tripped column count does not match!");
+    assert(results.columns[0] == first && results.columns[1] == second &&
+           "Round-tripped columns do not match!");
+
+    // ::::: Text format stays parseable line by line
+    ResultsWriter::writeText(path, first, 4);
+    assert(!ResultsWriter::isBinaryResultsFile(path) && "Text output should not probe as binary!");
+    std::ifstream text(path);
+    int node;
+    double score;
+    assert((text >> node >> score) && node == 0 && std::abs(score - 0.25) < 1e-9 &&
+           "Text output line does not match!");
+    std::remove(path.c_str());
+
+    std::cout << "✓ Results writer test passed\n";
+}
+
+void verifyInstrumentation() {
+    std::cout << "Instrumentation Test:\n";
+
+    // ::::: Disabled is the default: nothing is recorded
+    Instrumentation::reset();
+    Instrumentation::addCount("ignored", 1);
+    assert(Instrumentation::toJson().find("ignored") == std::string::npos &&
+           "Disabled instrumentation recorded a counter!");
+
+    // ::::: Enabled: stage timers and algorithm counters show up in the JSON
+    Instrumentation::enable();
+    {
+        Instrumentation::ScopedTimer timer("stage.test");
+        Graph graph = GraphBuilder::createCompleteGraph(6);
+        KCore::decompose(graph);
+    }
+    std::string json = Instrumentation::toJson();
+    assert(json.find("\"stage.test\"") != std::string::npos && "Stage timer missing from JSON!");
+    assert(json.find("\"kcore.edge_traversals\"") != std::string::npos &&
+           "KCore counter missing from JSON!");
+    assert(json.find("\"kcore.degree_decrements\"") != std::string::npos &&
+           "KCore decrement counter missing from JSON!");
+
+    // ::::: Leave the registry clean and disabled for the other tests
+    Instrumentation::enable(false);
+    Instrumentation::reset();
+    assert(Instrumentation::toJson().find("kcore") == std::string::npos &&
+           "Reset did not clear the registry!");
+
+    std::cout << "✓ Instrumentation test passed\n";
+}
+
+void verifyTriangles() {
+    std::cout << "Triangle Counting Test:\n";
+
+    // ::::: Complete graph: every triple is a triangle, clustering is 1
+    Graph complete = GraphBuilder::createCompleteGraph(5);
+    auto completeResult = Triangles::count(complete);
+    std::cout << completeResult.getSummary();
+    assert(completeResult.totalTriangles == 10 && "Complete graph triangle total does not match!");
+    for (int v = 0; v < 5; ++v) {
+        assert(completeResult.triangleCounts[v] == 6 && "Complete graph per-node count does not match!");
+        assert(std::abs(completeResult.clusteringCoefficients[v] - 1.0) < 1e-9 &&
+               "Complete graph clustering does not match!");
+    }
+    assert(std::abs(completeResult.transitivity - 1.0) < 1e-9 &&
+           "Complete graph transitivity does not match!");
+
+    // ::::: A star is all wedges and no triangles
+    Graph star = GraphBuilder::createStarGraph(6);
+    auto starResult = Triangles::count(star);
+    assert(starResult.totalTriangles == 0 && "Star graph should have no triangles!");
+    assert(starResult.transitivity == 0.0 && "Star graph transitivity should be zero!");
+
+    // ::::: Triangle with a pendant: the attachment vertex has 3 neighbor
+    // ::::: pairs but only the triangle pair is closed
+    Graph pendant(false);
+    pendant.addEdge(0, 1, 1.0);
+    pendant.addEdge(1, 2, 1.0);
+    pendant.addEdge(2, 0, 1.0);
+    pendant.addEdge(2, 3, 1.0);
+    auto pendantResult = Triangles::count(pendant);
+    assert(pendantResult.totalTriangles == 1 && "Pendant graph triangle total does not match!");
+    assert(std::abs(pendantResult.clusteringCoefficients[2] - 1.0 / 3.0) < 1e-9 &&
+           "Attachment vertex clustering does not match!");
+    assert(pendantResult.clusteringCoefficients[3] == 0.0 && "Pendant vertex clustering should be zero!");
+
+    // ::::: Directed edges count through the undirected projection, and the
+    // ::::: thread count must not change the result
+    Graph random = GraphBuilder::createRandomGraph(60, 0.1, 1.0, true);
+    random.addEdge(58, 59, 1.0);
+    auto serial = Triangles::count(random, 1);
+    auto parallel = Triangles::count(random, 4);
+    assert(serial.totalTriangles == parallel.totalTriangles &&
+           "Parallel triangle total does not match serial!");
+    for (int v = 0; v < random.getNumVertices(); ++v) {
+        assert(serial.triangleCounts[v] == parallel.triangleCounts[v] &&
+               "Parallel per-node counts do not match serial!");
+    }
+
+    std::cout << "✓ Triangle counting test passed\n";
+}
+
+void verifyBetweenness() {
+    std::cout << "Betweenness Test:\n";
+
+    // ::::: Path 0-1-2-3: the interior vertices each sit on two shortest paths
+    Graph path = GraphBuilder::createPathGraph(4);
+    auto pathResult = Betweenness::calculate(path);
+    std::cout << pathResult.getSummary();
+    std::vector<double> expectedPath = {0.0, 2.0, 2.0, 0.0};
+    for (size_t v = 0; v < expectedPath.size(); ++v) {
+        assert(std::abs(pathResult.centralityScores[v] - expectedPath[v]) < 1e-9 &&
+               "Path betweenness does not match!");
+    }
+
+    // ::::: Star: the hub carries every leaf pair, (n-1)(n-2)/2 of them
+    Graph star = GraphBuilder::createStarGraph(5);
+    auto starResult = Betweenness::calculate(star);
+    assert(std::abs(starResult.centralityScores[0] - 6.0) < 1e-9 && "Star hub betweenness does not match!");
+    assert(starResult.maxCentrality == starResult.centralityScores[0] && "Max centrality does not match!");
+
+    // ::::: Thread count must not change the result
+    Graph random = GraphBuilder::createRandomGraph(30, 0.1, 1.0, true);
+    random.addEdge(28, 29, 1.0);
+    auto serial = Betweenness::calculate(random, 0, 1);
+    auto parallel = Betweenness::calculate(random, 0, 4);
+    for (int v = 0; v < random.getNumVertices(); ++v) {
+        assert(std::abs(serial.centralityScores[v] - parallel.centralityScores[v]) < 1e-9 &&
+               "Parallel betweenness does not match serial!");
+    }
+
+    // ::::: Sampling half the sources still finds the same top vertex
+    auto sampled = Betweenness::calculate(star, 3);
+    assert(sampled.sampledSources == 3 && "Sampled source count does not match!");
+    auto topExact = TopK::select(starResult.centralityScores, 1);
+    auto topSampled = TopK::select(sampled.centralityScores, 1);
+    assert(topExact[0].first == topSampled[0].first && "Sampled top vertex does not match!");
+
+    std::cout << "✓ Betweenness test passed\n";
+}
+
+void verifyLandmarkIndex() {
+    std::cout << "Landmark Index Test:\n";
+
+    for (bool directed : {false, true}) {
+        Graph graph = GraphBuilder::createRandomGraph(40, 0.08, 1.0, directed);
+        // ::::: Random graphs can skip high vertex ids; pin the full range
+        graph.addEdge(38, 39, 1.0);
+
+        LandmarkIndex index = LandmarkIndex::build(graph, 5);
+        assert(index.getNumLandmarks() == 5 && "Landmark count does not match!");
+
+        // ::::: Bounds must bracket the true BFS distance and the exact
+        // ::::: query must equal it, for every pair from a few sources
+        for (int source : {0, 17, 39}) {
+            auto [traversal, distances] = GraphTraversal::bfs(graph, source);
+            (void)traversal;
+            for (int target = 0; target < graph.getNumVertices(); ++target) {
+                auto bounds = index.estimateDistance(source, target);
+                int exact = index.exactDistance(graph, source, target);
+                assert(exact == distances[target] && "Exact landmark distance does not match BFS!");
+                if (distances[target] >= 0) {
+                    assert(bounds.lowerBound <= distances[target] && "Landmark lower bound is too high!");
+                    assert(bounds.upperBound >= distances[target] && "Landmark upper bound is too low!");
+                }
+            }
+        }
+
+        // ::::: Round-trip through the binary format
+        const std::string path = "test_landmarks.bin";
+        index.save(path);
+        LandmarkIndex loaded = LandmarkIndex::load(path);
+        std::remove(path.c_str());
+        assert(loaded.getLandmarks() == index.getLandmarks() && "Loaded landmarks do not match!");
+        auto before = index.estimateDistance(0, 17);
+        auto after = loaded.estimateDistance(0, 17);
+        assert(before.lowerBound == after.lowerBound && before.upperBound == after.upperBound &&
+               "Loaded bounds do not match!");
+    }
+
+    std::cout << "✓ Landmark index test passed\n";
+}
+
+void verifyReordering() {
+    std::cout << "Vertex Reordering Test:\n";
+
+    // ::::: Sparse, shuffled ids like real GitHub user ids
+    Graph sparse(false);
+    sparse.addEdge(5000, 17, 2.0);
+    sparse.addEdge(17, 920, 1.0);
+    sparse.addEdge(920, 5000, 1.0);
+    sparse.addEdge(5000, 31, 1.0);
+    sparse.addEdge(88, 31, 3.0);
+
+    for (const auto& ordering : {GraphBuilder::computeDegreeOrdering(sparse),
+                                 GraphBuilder::computeRCMOrdering(sparse)}) {
+        // ::::: The mapping must be a bijection over the vertex set
+        assert(ordering.newToOld.size() == static_cast<size_t>(sparse.getNumVertices()) &&
+               "Ordering does not cover every vertex!");
+        for (size_t v = 0; v < ordering.newToOld.size(); ++v) {
+            assert(ordering.toNew(ordering.toOld(static_cast<int>(v))) == static_cast<int>(v) &&
+                   "Ordering mapping does not round-trip!");
+        }
+
+        // ::::: Relabeled graph: dense ids, same structure under translation
+        Graph relabeled = GraphBuilder::relabelGraph(sparse, ordering);
+        assert(relabeled.getNumVertices() == sparse.getNumVertices() && "Relabeled vertex count does not match!");
+        assert(relabeled.getNumEdges() == sparse.getNumEdges() && "Relabeled edge count does not match!");
+        assert(relabeled.hasEdge(ordering.toNew(5000), ordering.toNew(17)) && "Relabeled edge is missing!");
+        assert(relabeled.getEdgeWeight(ordering.toNew(88), ordering.toNew(31)) == 3.0 &&
+               "Relabeled edge weight does not match!");
+
+        // ::::: Dense ids make the graph usable by the flat-array kernels;
+        // ::::: the structure (a triangle plus two pendants) is preserved
+        auto reordered = KCore::decompose(relabeled);
+        assert(reordered.maxCoreNumber == 2 && "Relabeled max core number does not match!");
+    }
+
+    // ::::: Degree ordering puts the highest-degree hub at id 0
+    auto byDegree = GraphBuilder::computeDegreeOrdering(sparse);
+    assert(byDegree.toOld(0) == 5000 && "Degree ordering should start with the hub!");
+
+    std::cout << "✓ Vertex reordering test passed\n";
+}
+
+void verifyBulkLoad() {
+    std::cout << "Bulk Load Test:\n";
+
+    // ::::: Same edges (with duplicates) through both insertion paths
+    Graph checked(true);
+    checked.addEdge(0, 1, 1.0);
+    checked.addEdge(0, 2, 2.0);
+    checked.addEdge(0, 1, 3.0);  // ::::: Overwrites the first weight
+    checked.addEdge(2, 1, 1.0);
+
+    Graph bulk(true);
+    bulk.addEdgeUnchecked(0, 1, 1.0);
+    bulk.addEdgeUnchecked(0, 2, 2.0);
+    bulk.addEdgeUnchecked(0, 1, 3.0);
+    bulk.addEdgeUnchecked(2, 1, 1.0);
+    bulk.finalizeEdges();
+
+    assert(bulk.getNumEdges() == checked.getNumEdges() && "Bulk-loaded edge count does not match!");
+    assert(bulk.getEdgeWeight(0, 1) == checked.getEdgeWeight(0, 1) && "Bulk-loaded duplicate weight does not match!");
+    assert(bulk.hasEdge(2, 1) && !bulk.hasEdge(1, 2) && "Bulk-loaded adjacency does not match!");
+
+    std::cout << "✓ Bulk load test passed\n";
+}
+
+void verifyGraphFile(const Graph& graph) {
+    const std::string path = "test_graph.bin";
+    CSRGraph csr = CSRGraph::fromGraph(graph);
+    GraphFile::save(csr, path);
+
+    std::cout << "Graph File Test:\n";
+    MappedCSRGraph mapped(path);
+    assert(mapped.getNumVertices() == csr.getNumVertices() && "Mapped vertex count does not match!");
+    assert(mapped.getNumEdges() == csr.getNumEdges() && "Mapped edge count does not match!");
+    assert(mapped.isDirectedGraph() == csr.isDirectedGraph() && "Mapped directedness does not match!");
+
+    // ::::: Algorithms must see identical adjacency through the mapping
+    auto [traversal, distances] = GraphTraversal::bfs(csr, 0);
+    auto [mappedTraversal, mappedDistances] = GraphTraversal::bfs(mapped, 0);
+    assert(distances == mappedDistances && "Mapped BFS distances do not match!");
+
+    std::remove(path.c_str());
+    std::cout << "✓ Graph file test passed\n";
+}
+
 void verifyLouvain(const Graph& graph, int expectedMinCommunities) {
     auto result = Louvain::detectCommunities(graph);
     std::cout << "Louvain Test:\n" << result.getSummary();
@@ -145,20 +556,31 @@ int main() {
         cyclicGraph.addEdge(2, 0, 1.0); 
         
         verifyBFS(cyclicGraph, 0, {0, 1, 2});
+        verifyComponents(cyclicGraph, 1);
         verifyDijkstra(cyclicGraph, 0, {0.0, 1.0, 2.0});
         verifyHITS(cyclicGraph, 0.5774, 0.5774);
         verifyKCore(cyclicGraph, 1);
         verifyLouvain(cyclicGraph, 1);
+        verifyCSR(cyclicGraph);
+        verifyCompact(cyclicGraph);
+        verifyGraphFile(cyclicGraph);
+        verifyBulkLoad();
+        verifyIncremental();
+        verifyReordering();
+        verifyLandmarkIndex();
+        verifyTriangles();
+        verifyBetweenness();
+        verifyResultsWriter();
+        verifyInstrumentation();
         printSeparator();
 
         // ::::: Test Case 2: Star graph (directed outward)
         std::cout << "Test Case 2: Star graph\n";
-        Graph starGraph(true);-
+        Graph starGraph(true);
         for (int i = 1; i < 5; ++i) {
-            starGraph.addEdge(0, i, 1.0);  =
+            starGraph.addEdge(0, i, 1.0);
         }
         
-        =
         verifyBFS(starGraph, 0, {0, 1, 1, 1, 1});
         verifyDijkstra(starGraph, 0, {0.0, 1.0, 1.0, 1.0, 1.0});
         verifyHITS(starGraph, 0.9999, 0.5);
@@ -173,6 +595,7 @@ int main() {
         disconnectedGraph.addEdge(2, 3, 1.0); 
 
         verifyBFS(disconnectedGraph, 0, {0, 1, -1, -1});
+        verifyComponents(disconnectedGraph, 2);
         verifyDijkstra(disconnectedGraph, 0, {0.0, 1.0, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()});
         verifyHITS(disconnectedGraph, 0.7071, 0.7071);
         verifyKCore(disconnectedGraph, 0);
@@ -185,10 +608,10 @@ int main() {
         weightedGraph.addEdge(0, 1, 2.0);  
         weightedGraph.addEdge(1, 2, 3.0);  
         weightedGraph.addEdge(2, 0, 1.0);  
-        weightedGraph.addEdge(0, 2, 10.0); =
+        weightedGraph.addEdge(0, 2, 10.0);
         
         verifyDijkstra(weightedGraph, 0, {0.0, 2.0, 5.0});
-        verifyHITS(weightedGraph, 0.8165, 0.7071);
+        verifyHITS(weightedGraph, 0.8507, 0.8507);
         verifyKCore(weightedGraph, 1);
         verifyLouvain(weightedGraph, 1);
         printSeparator();
@@ -0,0 +1,53 @@
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+// ::::: Partial top-k selection over a score array.
+// ::::: Keeps a bounded min-heap of k entries instead of materializing and
+// ::::: fully sorting all n (index, score) pairs, so selecting the usual
+// ::::: k ~ 10 out of millions of nodes is O(n log k) with O(k) memory.
+class TopK {
+public:
+    // ::::: Return up to k (index, score) pairs, highest score first.
+    // ::::: Ties are broken toward the lower index, so results are stable.
+    static std::vector<std::pair<int, double>> select(const std::vector<double>& scores, int k) {
+        if (k <= 0) {
+            throw std::invalid_argument("k must be positive");
+        }
+
+        // ::::: Heap ordered worst-first: lowest score (then highest index) on top
+        auto worseThan = [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+            if (a.first != b.first) return a.first > b.first;
+            return a.second < b.second;
+        };
+        std::priority_queue<std::pair<double, int>,
+                            std::vector<std::pair<double, int>>,
+                            decltype(worseThan)> heap(worseThan);
+
+        size_t limit = std::min(static_cast<size_t>(k), scores.size());
+        for (size_t i = 0; i < scores.size(); ++i) {
+            std::pair<double, int> candidate{scores[i], static_cast<int>(i)};
+            if (heap.size() < limit) {
+                heap.push(candidate);
+            } else if (worseThan(candidate, heap.top())) {
+                heap.pop();
+                heap.push(candidate);
+            }
+        }
+
+        // ::::: Drain worst-first, then reverse into descending order
+        std::vector<std::pair<int, double>> result(heap.size());
+        for (size_t i = heap.size(); i-- > 0;) {
+            result[i] = {heap.top().second, heap.top().first};
+            heap.pop();
+        }
+        return result;
+    }
+};
+
+#endif